@@ -272,6 +272,25 @@ int msg_send_to_self(msg_t *m);
  */
 int msg_send_int(msg_t *m, kernel_pid_t target_pid);
 
+/**
+ * @brief Send several messages at once without blocking.
+ *
+ * Delivers as many of the messages in @p m as possible to the target thread
+ * in a single critical section: the first one directly if the target is
+ * waiting for a message, the following ones to its message queue. Sending
+ * stops at the first message that does not fit into the queue. Can be called
+ * from an interrupt, then ``msg_t::sender_pid`` is set to @ref KERNEL_PID_ISR.
+ *
+ * @param[in] m             Array of @p num preallocated @ref msg_t structures,
+ *                          must not be NULL.
+ * @param[in] num           Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread.
+ *
+ * @return  Number of messages delivered, starting from ``m[0]``.
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Test if the message was sent inside an ISR.
  * @see msg_send_int()
@@ -309,6 +328,23 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive several messages at once.
+ *
+ * Blocks until a message was received like msg_receive(), but then takes up
+ * to @p max messages out of the thread's message queue, and from threads
+ * blocked in sending to it, in a single critical section. Threads processing
+ * bursts of messages can use this to avoid entering and leaving the kernel
+ * for every single one of them.
+ *
+ * @param[out] buf  Array of @p max preallocated ``msg_t`` structures, must
+ *                  not be NULL.
+ * @param[in] max   Maximum number of messages to receive, must not be 0.
+ *
+ * @return  Number of messages received into @p buf (at least 1).
+ */
+int msg_receive_bulk(msg_t *buf, unsigned max);
+
 /**
  * @brief Send a message, block until reply received.
  *
@@ -11,6 +11,22 @@
  * @defgroup    core_sync Synchronization
  * @brief       Mutex for thread synchronization
  * @ingroup     core
+ *
+ * ## Priority inheritance
+ *
+ * With the (pseudo) module `core_mutex_priority_inheritance` a mutex
+ * remembers the thread holding it. If a thread of higher priority blocks on
+ * the mutex, the holder temporarily runs with the priority of that thread
+ * until it unlocks the mutex. This bounds the time a high priority thread
+ * can be delayed by threads of medium priority while a low priority thread
+ * holds a mutex it needs (priority inversion).
+ *
+ * The implementation is deliberately simple: the boost is not propagated
+ * along chains of mutexes, a boosted thread that is itself blocked on another
+ * mutex keeps its position in that mutex's wait queue, and unlocking restores
+ * the priority the holder had when it acquired the mutex. Nested locking of
+ * several contended mutexes should therefore be released in reverse order.
+ *
  * @{
  *
  * @file
@@ -26,6 +42,7 @@
 
 #include "list.h"
 #include "atomic.h"
+#include "kernel_types.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -41,18 +58,38 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The thread currently holding the mutex or KERNEL_PID_UNDEF
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   Priority of @ref mutex_t::owner when it acquired the mutex
+     * @internal
+     */
+    uint8_t owner_original_priority;
+#endif
 } mutex_t;
 
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF, 0 }
+#else
 #define MUTEX_INIT { { NULL } }
+#endif
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF, 0 }
+#else
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @internal
@@ -70,6 +107,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+#endif
 }
 
 /**
@@ -80,6 +80,28 @@ int ringbuffer_add_one(ringbuffer_t *__restrict rb, char c);
  */
 unsigned ringbuffer_add(ringbuffer_t *__restrict rb, const char *buf, unsigned n);
 
+/**
+ * @brief           Get the contiguous free space at the end of the ringbuffer.
+ * @details         Lets a producer write elements into the ringbuffer in place
+ *                  instead of copying them in with ringbuffer_add(). The
+ *                  elements become available for reading by calling
+ *                  ringbuffer_add_commit() afterwards.
+ *                  If the free space wraps around the end of the buffer, only
+ *                  its first part is returned.
+ * @param[in,out]   rb       Ringbuffer to operate on.
+ * @param[out]      region   Start of the free space.
+ * @returns         Number of elements that can be written to @p region.
+ */
+unsigned ringbuffer_add_region(ringbuffer_t *__restrict rb, char **region);
+
+/**
+ * @brief           Make elements written to a region available for reading.
+ * @param[in,out]   rb    Ringbuffer to operate on.
+ * @param[in]       n     Number of elements written to the region returned by
+ *                        ringbuffer_add_region(). Must not exceed its size.
+ */
+void ringbuffer_add_commit(ringbuffer_t *__restrict rb, unsigned n);
+
 /**
  * @brief           Peek and remove oldest element from the ringbuffer.
  * @param[in,out]   rb   Ringbuffer to operate on.
@@ -96,6 +118,27 @@ int ringbuffer_get_one(ringbuffer_t *__restrict rb);
  */
 unsigned ringbuffer_get(ringbuffer_t *__restrict rb, char *buf, unsigned n);
 
+/**
+ * @brief           Peek the contiguous elements at the start of the ringbuffer.
+ * @details         Lets a consumer read elements in place instead of copying
+ *                  them out with ringbuffer_get(). They are removed by calling
+ *                  ringbuffer_get_commit() afterwards.
+ *                  If the elements wrap around the end of the buffer, only
+ *                  their first part is returned.
+ * @param[in]       rb       Ringbuffer to operate on.
+ * @param[out]      region   Start of the oldest elements.
+ * @returns         Number of elements that can be read from @p region.
+ */
+unsigned ringbuffer_get_region(const ringbuffer_t *__restrict rb, char **region);
+
+/**
+ * @brief           Remove elements read from a region.
+ * @param[in,out]   rb    Ringbuffer to operate on.
+ * @param[in]       n     Number of elements read from the region returned by
+ *                        ringbuffer_get_region(). Must not exceed its size.
+ */
+void ringbuffer_get_commit(ringbuffer_t *__restrict rb, unsigned n);
+
 /**
  * @brief           Remove a number of elements from the ringbuffer.
  * @param[in,out]   rb    Ringbuffer to operate on.
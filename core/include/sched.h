@@ -39,6 +39,14 @@
  * happens, threads with the same priority will only switch due to
  * voluntary or implicit context switches.
  *
+ * ## Round robin:
+ *
+ * With the `sched_round_robin` pseudomodule threads of equal priority
+ * additionally share the CPU in time slices of @ref SCHED_RR_SLICE. A
+ * timer is only armed while the running thread has at least one other
+ * runnable thread on its priority level, so the scheduler stays tickless
+ * otherwise.
+ *
  * ## Interrupts:
  *
  * When an interrupt occurs, e.g. because a timer fired or a network
@@ -104,6 +112,13 @@ typedef struct _thread thread_t;
 #define SCHED_PRIO_LEVELS 16
 #endif
 
+/**
+ * @brief   Length of a time slice in microseconds with `sched_round_robin`
+ */
+#ifndef SCHED_RR_SLICE
+#define SCHED_RR_SLICE      (10000U)
+#endif
+
 /**
  * @brief   Triggers the scheduler to schedule the next thread
  * @returns 1 if sched_active_thread/sched_active_pid was changed, 0 otherwise.
@@ -119,6 +134,22 @@ int sched_run(void);
  */
 void sched_set_status(thread_t *process, unsigned int status);
 
+/**
+ * @brief   Change the priority of the specified thread
+ *
+ * If the thread is on a run queue it is moved to the run queue of the new
+ * priority. The active thread is put at the head of its new run queue, so it
+ * keeps running unless a thread of higher priority is runnable.
+ *
+ * @note    This function does not yield. Call sched_switch() or
+ *          thread_yield_higher() if the change may require a context switch.
+ *
+ * @param[in]   process     Pointer to the thread control block of the
+ *                          targeted thread
+ * @param[in]   priority    The new priority of the thread
+ */
+void sched_change_priority(thread_t *process, uint8_t priority);
+
 /**
  * @brief       Yield if approriate.
  *
@@ -166,6 +197,10 @@ extern volatile kernel_pid_t sched_active_pid;
 
 /**
  * List of runqueues per priority level
+ *
+ * Every run queue is a circular list of the threads' `rq_entry`, the list
+ * head points to the tail. `thread_t::rq_prev` links the entries back, use
+ * sched_set_status() or sched_change_priority() to add or remove threads.
  */
 extern clist_node_t sched_runqueues[SCHED_PRIO_LEVELS];
 
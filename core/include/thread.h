@@ -177,6 +177,8 @@ struct _thread {
 #endif
 
     clist_node_t rq_entry;          /**< run queue entry                */
+    clist_node_t *rq_prev;          /**< previous run queue entry, only
+                                         valid while on a run queue     */
 
 #if defined(MODULE_CORE_MSG) || defined(MODULE_CORE_THREAD_FLAGS) \
     || defined(MODULE_CORE_MBOX)
@@ -208,6 +208,58 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     }
 }
 
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("msg_send_bulk(): target_pid is invalid, continuing anyways\n");
+    }
+#endif /* DEVELHELP */
+
+    int in_isr = irq_is_in();
+    kernel_pid_t sender_pid = in_isr ? KERNEL_PID_ISR : sched_active_pid;
+    unsigned state = irq_disable();
+    thread_t *target = (thread_t *) sched_threads[target_pid];
+    unsigned i = 0;
+    bool woken = false;
+
+    if (target == NULL) {
+        DEBUG("msg_send_bulk(): target thread does not exist\n");
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("msg_send_bulk: Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", sender_pid, target_pid);
+        /* copy first msg to target */
+        msg_t *target_message = (msg_t*) target->wait_data;
+        m[0].sender_pid = sender_pid;
+        *target_message = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        woken = true;
+        i++;
+    }
+    /* queue the rest */
+    for (; i < num; i++) {
+        m[i].sender_pid = sender_pid;
+        if (!queue_msg(target, &m[i])) {
+            break;
+        }
+    }
+
+    irq_restore(state);
+    if (woken) {
+        if (in_isr) {
+            sched_context_switch_request = 1;
+        }
+        else {
+            thread_yield_higher();
+        }
+    }
+    return i;
+}
+
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(sched_active_pid != target_pid);
@@ -363,6 +415,77 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_receive_bulk(msg_t *buf, unsigned max)
+{
+    assert(max > 0);
+
+    unsigned state = irq_disable();
+    DEBUG("msg_receive_bulk: %" PRIkernel_pid ": msg_receive_bulk.\n",
+          sched_active_thread->pid);
+
+    thread_t *me = (thread_t*) sched_threads[sched_active_pid];
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned num = 0;
+    int queue_index;
+
+    /* queued messages are older than those of waiting threads */
+    while ((num < max) && me->msg_array &&
+           ((queue_index = cib_get(&(me->msg_queue))) >= 0)) {
+        buf[num++] = me->msg_array[queue_index];
+    }
+
+    while (me->msg_waiters.next != NULL) {
+        thread_t *sender = container_of((clist_node_t*)me->msg_waiters.next,
+                                        thread_t, rq_entry);
+        msg_t *m;
+
+        if (num < max) {
+            m = &buf[num++];
+        }
+        else if (me->msg_array &&
+                 ((queue_index = cib_put(&(me->msg_queue))) >= 0)) {
+            /* take its message into the just freed queue space */
+            m = &(me->msg_array[queue_index]);
+        }
+        else {
+            break;
+        }
+        list_remove_head(&me->msg_waiters);
+
+        /* copy msg */
+        msg_t *sender_msg = (msg_t*) sender->wait_data;
+        *m = *sender_msg;
+
+        /* remove sender from queue */
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < sender_prio) {
+                sender_prio = sender->priority;
+            }
+        }
+    }
+
+    if (num == 0) {
+        DEBUG("msg_receive_bulk(): %" PRIkernel_pid ": No msg in queue. Going blocked.\n",
+              sched_active_thread->pid);
+        me->wait_data = (void *) buf;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied message */
+        return 1;
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return num;
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -35,6 +35,74 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+static inline void _set_owner(mutex_t *mutex, thread_t *owner)
+{
+    if (owner != NULL) {
+        mutex->owner = owner->pid;
+        mutex->owner_original_priority = owner->priority;
+    }
+    else {
+        mutex->owner = KERNEL_PID_UNDEF;
+    }
+}
+
+static inline void _inherit_priority(mutex_t *mutex, thread_t *waiter)
+{
+    /* sched_threads[KERNEL_PID_UNDEF] is always NULL */
+    thread_t *owner = (thread_t *)sched_threads[mutex->owner];
+
+    if ((owner != NULL) && (owner->priority > waiter->priority)) {
+        DEBUG("PID[%" PRIkernel_pid "]: boosting owner %" PRIkernel_pid
+              " to prio %" PRIu32 "\n", waiter->pid, owner->pid,
+              (uint32_t)waiter->priority);
+        sched_change_priority(owner, waiter->priority);
+    }
+}
+
+static inline int _restore_priority(mutex_t *mutex)
+{
+    thread_t *owner = (thread_t *)sched_threads[mutex->owner];
+
+    if ((owner != NULL) && (owner->priority != mutex->owner_original_priority)) {
+        DEBUG("PID[%" PRIkernel_pid "]: restoring prio %" PRIu32 "\n",
+              owner->pid, (uint32_t)mutex->owner_original_priority);
+        sched_change_priority(owner, mutex->owner_original_priority);
+        return 1;
+    }
+    return 0;
+}
+#else
+static inline void _set_owner(mutex_t *mutex, thread_t *owner)
+{
+    (void)mutex;
+    (void)owner;
+}
+
+static inline void _inherit_priority(mutex_t *mutex, thread_t *waiter)
+{
+    (void)mutex;
+    (void)waiter;
+}
+
+static inline int _restore_priority(mutex_t *mutex)
+{
+    (void)mutex;
+    return 0;
+}
+#endif
+
+/* a formerly boosted thread may no longer be the one that should run */
+static void _yield_after_restore(void)
+{
+    if (irq_is_in()) {
+        sched_context_switch_request = 1;
+    }
+    else {
+        thread_yield_higher();
+    }
+}
+
 int _mutex_lock(mutex_t *mutex, int blocking)
 {
     unsigned irqstate = irq_disable();
@@ -44,6 +112,7 @@ int _mutex_lock(mutex_t *mutex, int blocking)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        _set_owner(mutex, irq_is_in() ? NULL : (thread_t *)sched_active_thread);
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait early out.\n",
               sched_active_pid);
         irq_restore(irqstate);
@@ -61,10 +130,11 @@ int _mutex_lock(mutex_t *mutex, int blocking)
         else {
             thread_add_to_list(&mutex->queue, me);
         }
+        _inherit_priority(mutex, me);
         irq_restore(irqstate);
         thread_yield_higher();
-        /* We were woken up by scheduler. Waker removed us from queue.
-         * We have the mutex now. */
+        /* We were woken up by scheduler. Waker removed us from queue and
+         * made us the owner. We have the mutex now. */
         return 1;
     }
     else {
@@ -86,10 +156,16 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+    int restored = _restore_priority(mutex);
+
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
+        _set_owner(mutex, NULL);
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
+        if (restored) {
+            _yield_after_restore();
+        }
         return;
     }
 
@@ -100,6 +176,7 @@ void mutex_unlock(mutex_t *mutex)
     DEBUG("mutex_unlock: waking up waiting thread %" PRIkernel_pid "\n",
           process->pid);
     sched_set_status(process, STATUS_PENDING);
+    _set_owner(mutex, process);
 
     if (!mutex->queue.next) {
         mutex->queue.next = MUTEX_LOCKED;
@@ -107,7 +184,12 @@ void mutex_unlock(mutex_t *mutex)
 
     uint16_t process_priority = process->priority;
     irq_restore(irqstate);
-    sched_switch(process_priority);
+    if (restored) {
+        _yield_after_restore();
+    }
+    else {
+        sched_switch(process_priority);
+    }
 }
 
 void mutex_unlock_and_sleep(mutex_t *mutex)
@@ -117,8 +199,10 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+        _restore_priority(mutex);
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+            _set_owner(mutex, NULL);
         }
         else {
             list_node_t *next = list_remove_head(&mutex->queue);
@@ -126,6 +210,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
                                              rq_entry);
             DEBUG("PID[%" PRIkernel_pid "]: waking up waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
+            _set_owner(mutex, process);
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
@@ -54,14 +54,46 @@ static char get_head(ringbuffer_t *restrict rb)
 
 unsigned ringbuffer_add(ringbuffer_t *restrict rb, const char *buf, unsigned n)
 {
-    unsigned i;
-    for (i = 0; i < n; i++) {
-        if (ringbuffer_full(rb)) {
-            break;
+    if (n > rb->size - rb->avail) {
+        n = rb->size - rb->avail;
+    }
+    if (n > 0) {
+        unsigned pos = rb->start + rb->avail;
+        if (pos >= rb->size) {
+            pos -= rb->size;
+        }
+        unsigned bytes_till_end = rb->size - pos;
+        if (bytes_till_end >= n) {
+            memcpy(rb->buf + pos, buf, n);
         }
-        add_tail(rb, buf[i]);
+        else {
+            memcpy(rb->buf + pos, buf, bytes_till_end);
+            memcpy(rb->buf, buf + bytes_till_end, n - bytes_till_end);
+        }
+        rb->avail += n;
+    }
+    return n;
+}
+
+unsigned ringbuffer_add_region(ringbuffer_t *restrict rb, char **region)
+{
+    if (rb->avail == 0) {
+        /* make all of the buffer contiguous */
+        rb->start = 0;
+    }
+    unsigned pos = rb->start + rb->avail;
+    if (pos >= rb->size) {
+        pos -= rb->size;
+        *region = rb->buf + pos;
+        return rb->start - pos;
     }
-    return i;
+    *region = rb->buf + pos;
+    return rb->size - pos;
+}
+
+void ringbuffer_add_commit(ringbuffer_t *restrict rb, unsigned n)
+{
+    rb->avail += n;
 }
 
 int ringbuffer_add_one(ringbuffer_t *restrict rb, char c)
@@ -110,6 +142,22 @@ unsigned ringbuffer_get(ringbuffer_t *restrict rb, char *buf, unsigned n)
     return n;
 }
 
+unsigned ringbuffer_get_region(const ringbuffer_t *restrict rb, char **region)
+{
+    unsigned bytes_till_end = rb->size - rb->start;
+    *region = rb->buf + rb->start;
+    return (rb->avail < bytes_till_end) ? rb->avail : bytes_till_end;
+}
+
+void ringbuffer_get_commit(ringbuffer_t *restrict rb, unsigned n)
+{
+    rb->avail -= n;
+    rb->start += n;
+    if ((rb->avail == 0) || (rb->start == rb->size)) {
+        rb->start = 0;
+    }
+}
+
 unsigned ringbuffer_remove(ringbuffer_t *restrict rb, unsigned n)
 {
     if (n > rb->avail) {
@@ -33,7 +33,7 @@
 #include "mpu.h"
 #endif
 
-#ifdef MODULE_SCHEDSTATISTICS
+#if defined(MODULE_SCHEDSTATISTICS) || defined(MODULE_SCHED_ROUND_ROBIN)
 #include "xtimer.h"
 #endif
 
@@ -62,6 +62,105 @@ static void (*sched_cb) (uint32_t timestamp, uint32_t value) = NULL;
 schedstat sched_pidlist[KERNEL_PID_LAST + 1];
 #endif
 
+/* The run queues are circular lists of the threads' rq_entry with
+ * sched_runqueues[prio].next pointing to the tail. rq_prev links every entry
+ * back to its predecessor, so any thread can be removed in constant time. */
+static inline clist_node_t **_runq_prev(clist_node_t *node)
+{
+    return &container_of(node, thread_t, rq_entry)->rq_prev;
+}
+
+static void _runq_add(uint8_t prio, clist_node_t *node, int as_head)
+{
+    clist_node_t *list = &sched_runqueues[prio];
+
+    if (list->next) {
+        clist_node_t *tail = list->next;
+
+        node->next = tail->next;
+        *_runq_prev(node) = tail;
+        *_runq_prev(tail->next) = node;
+        tail->next = node;
+    }
+    else {
+        node->next = node;
+        *_runq_prev(node) = node;
+    }
+
+    /* inserting between tail and head makes the node the new head */
+    if (!as_head || !list->next) {
+        list->next = node;
+    }
+    runqueue_bitcache |= 1 << prio;
+}
+
+static void _runq_remove(uint8_t prio, clist_node_t *node)
+{
+    clist_node_t *list = &sched_runqueues[prio];
+
+    if (node->next == node) {
+        list->next = NULL;
+        runqueue_bitcache &= ~(1 << prio);
+    }
+    else {
+        clist_node_t *prev = *_runq_prev(node);
+
+        prev->next = node->next;
+        *_runq_prev(node->next) = prev;
+        if (list->next == node) {
+            list->next = prev;
+        }
+    }
+    node->next = NULL;
+}
+
+#ifdef MODULE_SCHED_ROUND_ROBIN
+static xtimer_t _rr_timer;
+/* thread the current time slice was started for */
+static kernel_pid_t _rr_pid = KERNEL_PID_UNDEF;
+
+static void _rr_expired(void *arg)
+{
+    (void)arg;
+    thread_t *active_thread = (thread_t *)sched_active_thread;
+
+    if (active_thread && (active_thread->pid == _rr_pid) &&
+        (active_thread->status == STATUS_RUNNING)) {
+        clist_node_t *list = &sched_runqueues[active_thread->priority];
+
+        DEBUG("sched: time slice of thread %" PRIkernel_pid " expired\n",
+              active_thread->pid);
+        /* rotating the run queue makes the next thread of the same priority
+         * its head */
+        if (list->next->next == &active_thread->rq_entry) {
+            clist_lpoprpush(list);
+        }
+        sched_context_switch_request = 1;
+    }
+    _rr_pid = KERNEL_PID_UNDEF;
+}
+
+/* starts a time slice for thread if it shares its run queue with others */
+static void _rr_start(thread_t *thread)
+{
+    clist_node_t *list = &sched_runqueues[thread->priority];
+
+    if (list->next->next == list->next) {
+        if (_rr_pid != KERNEL_PID_UNDEF) {
+            xtimer_remove(&_rr_timer);
+            _rr_pid = KERNEL_PID_UNDEF;
+        }
+        return;
+    }
+
+    if (_rr_pid != thread->pid) {
+        _rr_pid = thread->pid;
+        _rr_timer.callback = _rr_expired;
+        xtimer_set(&_rr_timer, SCHED_RR_SLICE);
+    }
+}
+#endif
+
 int __attribute__((used)) sched_run(void)
 {
     sched_context_switch_request = 0;
@@ -119,6 +218,10 @@ int __attribute__((used)) sched_run(void)
     sched_active_pid = next_thread->pid;
     sched_active_thread = (volatile thread_t *) next_thread;
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    _rr_start(next_thread);
+#endif
+
 #ifdef MODULE_MPU_STACK_GUARD
     mpu_configure(
         1,                                                /* MPU region 1 */
@@ -147,25 +250,50 @@ void sched_set_status(thread_t *process, unsigned int status)
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             DEBUG("sched_set_status: adding thread %" PRIkernel_pid " to runqueue %" PRIu16 ".\n",
                   process->pid, process->priority);
-            clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
-            runqueue_bitcache |= 1 << process->priority;
+            _runq_add(process->priority, &(process->rq_entry), 0);
+
+#ifdef MODULE_SCHED_ROUND_ROBIN
+            thread_t *active_thread = (thread_t *)sched_active_thread;
+
+            if (active_thread && (active_thread->status == STATUS_RUNNING) &&
+                (active_thread->priority == process->priority)) {
+                _rr_start(active_thread);
+            }
+#endif
         }
     }
     else {
         if (process->status >= STATUS_ON_RUNQUEUE) {
             DEBUG("sched_set_status: removing thread %" PRIkernel_pid " to runqueue %" PRIu16 ".\n",
                   process->pid, process->priority);
-            clist_lpop(&sched_runqueues[process->priority]);
-
-            if (!sched_runqueues[process->priority].next) {
-                runqueue_bitcache &= ~(1 << process->priority);
-            }
+            _runq_remove(process->priority, &(process->rq_entry));
         }
     }
 
     process->status = status;
 }
 
+void sched_change_priority(thread_t *process, uint8_t priority)
+{
+    unsigned irqstate = irq_disable();
+
+    if (process->priority == priority) {
+        irq_restore(irqstate);
+        return;
+    }
+
+    if (process->status >= STATUS_ON_RUNQUEUE) {
+        DEBUG("sched_change_priority: moving thread %" PRIkernel_pid " from runqueue %" PRIu16
+              " to %" PRIu16 ".\n", process->pid, process->priority, priority);
+        _runq_remove(process->priority, &(process->rq_entry));
+        /* the running thread must stay at the head of its runqueue */
+        _runq_add(priority, &(process->rq_entry), (process == sched_active_thread));
+    }
+
+    process->priority = priority;
+    irq_restore(irqstate);
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = (thread_t *) sched_active_thread;
@@ -18,14 +18,153 @@
  */
 
 #include <err.h>
+#include <errno.h>
 #include <signal.h>
+#include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
 
+#include "irq.h"
 #include "async_read.h"
 #include "native_internal.h"
 
+#ifdef ASYNC_READ_EPOLL
+/**
+ * @brief   Handler of a file descriptor, indexed by the file descriptor
+ */
+typedef struct {
+    native_async_read_callback_t cb;    /**< callback, NULL if not monitored */
+    void *arg;                          /**< argument of the callback */
+    int next_ready;                     /**< next fd in the ready list */
+    bool ready;                         /**< fd was signalled and not continued */
+    bool linked;                        /**< fd is part of the ready list */
+} _handler_t;
+
+static int _epfd = -1;
+static _handler_t *_handlers;
+static int _handlers_numof;
+/* fds that were signalled and not continued yet, linked by next_ready */
+static int _ready = -1;
+
+static void _ready_push(int fd)
+{
+    _handlers[fd].ready = true;
+    if (!_handlers[fd].linked) {
+        _handlers[fd].linked = true;
+        _handlers[fd].next_ready = _ready;
+        _ready = fd;
+    }
+}
+
+static void _async_io_isr(void) {
+    struct epoll_event events[ASYNC_READ_EPOLL_EVENTS];
+    int num;
+
+    /* edge triggered: every signalled fd is reported once, so keep it in the
+     * ready list until its driver calls native_async_read_continue() */
+    do {
+        num = epoll_wait(_epfd, events, ASYNC_READ_EPOLL_EVENTS, 0);
+        for (int i = 0; i < num; i++) {
+            _ready_push(events[i].data.fd);
+        }
+    } while (num == ASYNC_READ_EPOLL_EVENTS);
+
+    for (int *fd = &_ready; *fd >= 0;) {
+        _handler_t *handler = &_handlers[*fd];
+
+        if (!handler->ready) {
+            handler->linked = false;
+            *fd = handler->next_ready;
+            continue;
+        }
+        handler->cb(*fd, handler->arg);
+        fd = &handler->next_ready;
+    }
+}
+
+void native_async_read_setup(void) {
+    if (_epfd < 0) {
+        _epfd = epoll_create1(EPOLL_CLOEXEC);
+        if (_epfd < 0) {
+            err(EXIT_FAILURE, "native_async_read_setup(): epoll_create1");
+        }
+    }
+    register_interrupt(SIGIO, _async_io_isr);
+}
+
+void native_async_read_cleanup(void) {
+    unregister_interrupt(SIGIO);
+
+    if (_epfd >= 0) {
+        real_close(_epfd);
+        _epfd = -1;
+    }
+    real_free(_handlers);
+    _handlers = NULL;
+    _handlers_numof = 0;
+    _ready = -1;
+}
+
+void native_async_read_continue(int fd) {
+    if ((fd >= 0) && (fd < _handlers_numof)) {
+        /* removed from the ready list by the next interrupt */
+        _handlers[fd].ready = false;
+    }
+}
+
+void native_async_read_add_handler(int fd, void *arg, native_async_read_callback_t handler) {
+    struct epoll_event event = { .events = EPOLLIN | EPOLLET, .data.fd = fd };
+
+    if (fd >= _handlers_numof) {
+        int numof = (_handlers_numof > 0) ? _handlers_numof : ASYNC_READ_NUMOF;
+
+        while (numof <= fd) {
+            numof *= 2;
+        }
+
+        unsigned state = irq_disable();
+        _handler_t *handlers = real_realloc(_handlers, numof * sizeof(_handler_t));
+
+        if (handlers == NULL) {
+            err(EXIT_FAILURE, "native_async_read_add_handler(): realloc");
+        }
+        memset(&handlers[_handlers_numof], 0,
+               (numof - _handlers_numof) * sizeof(_handler_t));
+        _handlers = handlers;
+        _handlers_numof = numof;
+        irq_restore(state);
+    }
+
+    _handlers[fd].cb = handler;
+    _handlers[fd].arg = arg;
+
+    if (epoll_ctl(_epfd, EPOLL_CTL_ADD, fd, &event) == -1) {
+        if (errno != EPERM) {
+            err(EXIT_FAILURE, "native_async_read_add_handler(): epoll_ctl");
+        }
+        /* regular files can not be polled but are always readable, as with
+         * select() */
+        unsigned state = irq_disable();
+        _ready_push(fd);
+        irq_restore(state);
+    }
+
+    /* configure fds to send signals on io */
+    if (fcntl(fd, F_SETOWN, _native_pid) == -1) {
+        err(EXIT_FAILURE, "native_async_read_add_handler(): fcntl(F_SETOWN)");
+    }
+    /* set file access mode to non-blocking */
+    if (fcntl(fd, F_SETFL, O_NONBLOCK | O_ASYNC) == -1) {
+        err(EXIT_FAILURE, "native_async_read_add_handler(): fcntl(F_SETFL)");
+    }
+}
+
+#else /* ASYNC_READ_EPOLL */
 static int _next_index;
 static int _fds[ASYNC_READ_NUMOF];
 static void *_args[ASYNC_READ_NUMOF];
@@ -161,4 +300,5 @@ static void _sigio_child(int index)
     }
 }
 #endif
+#endif /* ASYNC_READ_EPOLL */
 /** @} */
@@ -24,11 +24,36 @@ extern "C" {
 
 /**
  * @brief   Maximum number of file descriptors
+ *
+ * With @ref ASYNC_READ_EPOLL this is only the initial size of the handler
+ * table, which grows as needed.
  */
 #ifndef ASYNC_READ_NUMOF
 #define ASYNC_READ_NUMOF 2
 #endif
 
+#if defined(__linux__) && !defined(ASYNC_READ_SELECT) || defined(DOXYGEN)
+/**
+ * @brief   Use epoll to find the file descriptors to read from on SIGIO
+ *
+ * The descriptors are registered edge triggered, so an interrupt only costs
+ * time for the descriptors that are actually readable and the number of
+ * descriptors is not limited. A descriptor stays pending until its driver
+ * calls @ref native_async_read_continue().
+ *
+ * This is the default on Linux. Define `ASYNC_READ_SELECT` to fall back to
+ * select(), which is used on all other hosts.
+ */
+#define ASYNC_READ_EPOLL
+
+/**
+ * @brief   Number of epoll events fetched at once
+ */
+#ifndef ASYNC_READ_EPOLL_EVENTS
+#define ASYNC_READ_EPOLL_EVENTS (8)
+#endif
+#endif
+
 /**
  * @brief   asynchronus read callback type
  */
@@ -51,7 +76,8 @@ void native_async_read_cleanup(void);
 /**
  * @brief   resume monitoring of file descriptors
  *
- * Call this function after reading file descriptors.
+ * Call this function after reading file descriptors, once no more data is
+ * available.
  *
  * @param[in] fd  The file descriptor to monitor
  */
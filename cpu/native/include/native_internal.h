@@ -70,10 +70,36 @@ void native_irq_handler(void);
 extern void _native_sig_leave_tramp(void);
 extern void _native_sig_leave_handler(void);
 
+/**
+ * context switching, see context.S for the native_asm_context variant
+ */
+#ifdef MODULE_NATIVE_ASM_CONTEXT
+int _native_swapcontext(ucontext_t *oucp, const ucontext_t *ucp);
+int _native_setcontext(const ucontext_t *ucp);
+#else
+#define _native_swapcontext swapcontext
+#define _native_setcontext setcontext
+#endif
+
 void _native_syscall_leave(void);
 void _native_syscall_enter(void);
 void _native_init_syscalls(void);
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+/**
+ * virtual time, see virtual_time.c
+ */
+#ifndef NATIVE_VTIME_INSTANCES
+#define NATIVE_VTIME_INSTANCES (16U)   /**< instances sharing one clock */
+#endif
+#define NATIVE_VTIME_NONE (UINT64_MAX) /**< deadline of a disarmed timer */
+
+void _native_vtime_init(const char *path);
+uint64_t _native_vtime_now(void);
+void _native_vtime_arm(uint64_t deadline);
+void _native_vtime_sleep(void);
+#endif
+
 /**
  * external functions regularly wrapped in native for direct use
  */
@@ -9,6 +9,14 @@
 /**
  * @ingroup     netdev2
  * @brief       Low-level ethernet driver for native tap interfaces
+ *
+ * By default every received frame is announced by its own SIGIO. With the
+ * `netdev2_tap_batch` pseudomodule the driver instead drains the tap
+ * interface on every interrupt: it keeps signalling
+ * @ref NETDEV2_EVENT_RX_COMPLETE to the upper layer until reading from the
+ * tap fails with `EAGAIN`, so a burst of frames costs only one interrupt.
+ * The upper layer reads every frame directly into its own buffer (for GNRC
+ * into a packet buffer snip), as before.
  * @{
  *
  * @file
@@ -24,6 +32,7 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "net/netdev2.h"
 
@@ -35,6 +44,18 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief   Maximum number of frames handled per interrupt with
+ *          `netdev2_tap_batch`
+ *
+ * @details If the tap interface still has frames pending after this number
+ *          of frames another interrupt is raised, so the upper layer gets
+ *          the chance to handle other events in between.
+ */
+#ifndef NETDEV2_TAP_RX_BURST
+#define NETDEV2_TAP_RX_BURST    (32U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +65,9 @@ typedef struct netdev2_tap {
     int tap_fd;                         /**< host file descriptor for the TAP */
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     uint8_t promiscous;                 /**< Flag for promiscous mode */
+#if defined(MODULE_NETDEV2_TAP_BATCH) || defined(DOXYGEN)
+    bool rx_drained;                    /**< the last read found no frame */
+#endif
 } netdev2_tap_t;
 
 /**
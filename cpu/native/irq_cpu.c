@@ -145,6 +145,41 @@ void native_print_signals(void)
     }
 }
 
+#ifdef MODULE_NATIVE_VIRTUAL_IRQ
+/*
+ * Interrupts are only masked by native_interrupts_enabled, the process' signal
+ * mask is never touched. Signals arriving while interrupts are disabled are
+ * recorded by native_isr_entry() and replayed on irq_enable(), so neither
+ * needs a system call.
+ */
+unsigned irq_disable(void)
+{
+    unsigned int prev_state = native_interrupts_enabled;
+
+    /* if a signal sneaks in right here, its ISR completes before
+     * interrupts get disabled, just as on hardware */
+    native_interrupts_enabled = 0;
+
+    return prev_state;
+}
+
+unsigned irq_enable(void)
+{
+    unsigned int prev_state = native_interrupts_enabled;
+
+    native_interrupts_enabled = 1;
+
+    if (_native_sigpend > 0) {
+        /* run the ISR for signals recorded while interrupts were disabled
+         * (unless called from within a syscall or the ISR itself, which
+         * handle them on their own) */
+        _native_syscall_enter();
+        _native_syscall_leave();
+    }
+
+    return prev_state;
+}
+#else /* MODULE_NATIVE_VIRTUAL_IRQ */
 /**
  * block signals
  */
@@ -207,6 +242,7 @@ unsigned irq_enable(void)
 
     return prev_state;
 }
+#endif /* MODULE_NATIVE_VIRTUAL_IRQ */
 
 void irq_restore(unsigned state)
 {
@@ -258,7 +294,8 @@ void native_irq_handler(void)
 
     while (_native_sigpend > 0) {
         int sig = _native_popsig();
-        _native_sigpend--;
+        /* atomic with respect to native_isr_entry() incrementing it */
+        __sync_fetch_and_sub(&_native_sigpend, 1);
 
         if (native_irq_handlers[sig] != NULL) {
             DEBUG("native_irq_handler: calling interrupt handler for %i\n", sig);
@@ -278,7 +315,13 @@ void native_irq_handler(void)
 
 void isr_set_sigmask(ucontext_t *ctx)
 {
+#ifdef MODULE_NATIVE_VIRTUAL_IRQ
+    /* signals stay unblocked, native_isr_entry() records them while the ISR
+     * runs */
+    sigemptyset(&ctx->uc_sigmask);
+#else
     ctx->uc_sigmask = _native_sig_set_dint;
+#endif
     native_interrupts_enabled = 0;
 }
 
@@ -308,7 +351,8 @@ void native_isr_entry(int sig, siginfo_t *info, void *context)
     }
 
     /* XXX: Workaround safety check - whenever this happens it really
-     * indicates a bug in irq_disable */
+     * indicates a bug in irq_disable. With native_virtual_irq this is how
+     * signals are deferred while interrupts are disabled. */
     if (native_interrupts_enabled == 0) {
         //printf("interrupts are off, but I caught a signal.\n");
         return;
@@ -39,7 +39,14 @@ void lpm_init(void)
 void _native_lpm_sleep(void)
 {
     _native_in_syscall++; // no switching here
-    real_pause();
+    /* don't wait for the next signal if one is still to be handled */
+    if (_native_sigpend == 0) {
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+        _native_vtime_sleep();
+#else
+        real_pause();
+#endif
+    }
     _native_in_syscall--;
 
     if (_native_sigpend > 0) {
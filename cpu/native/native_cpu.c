@@ -21,6 +21,7 @@
  * @author  Kaspar Schleiser <kaspar@schleiser.de>
  */
 
+#include <stddef.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <stdlib.h>
@@ -59,6 +60,14 @@ extern netdev2_tap_t netdev2_tap;
 
 #include "native_internal.h"
 
+#ifdef MODULE_NATIVE_ASM_CONTEXT
+/* context.S hard codes glibc's i386 ucontext_t layout */
+typedef char _native_asm_context_layout_check[
+    ((offsetof(ucontext_t, uc_mcontext.gregs) == 20) &&
+     (REG_EDI == 4) && (REG_ESI == 5) && (REG_EBP == 6) && (REG_ESP == 7) &&
+     (REG_EBX == 8) && (REG_EIP == 14)) ? 1 : -1];
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -152,7 +161,7 @@ void isr_cpu_switch_context_exit(void)
     native_interrupts_enabled = 1;
     _native_mod_ctx_leave_sigh(ctx);
 
-    if (setcontext(ctx) == -1) {
+    if (_native_setcontext(ctx) == -1) {
         err(EXIT_FAILURE, "isr_cpu_switch_context_exit: setcontext");
     }
     errx(EXIT_FAILURE, "2 this should have never been reached!!");
@@ -174,7 +183,7 @@ void cpu_switch_context_exit(void)
         native_isr_context.uc_stack.ss_size = sizeof(__isr_stack);
         native_isr_context.uc_stack.ss_flags = 0;
         makecontext(&native_isr_context, isr_cpu_switch_context_exit, 0);
-        if (setcontext(&native_isr_context) == -1) {
+        if (_native_setcontext(&native_isr_context) == -1) {
             err(EXIT_FAILURE, "cpu_switch_context_exit: setcontext");
         }
         errx(EXIT_FAILURE, "1 this should have never been reached!!");
@@ -201,7 +210,7 @@ void isr_thread_yield(void)
     native_interrupts_enabled = 1;
     _native_mod_ctx_leave_sigh(ctx);
 
-    if (setcontext(ctx) == -1) {
+    if (_native_setcontext(ctx) == -1) {
         err(EXIT_FAILURE, "isr_thread_yield: setcontext");
     }
 }
@@ -219,7 +228,7 @@ void thread_yield_higher(void)
         native_isr_context.uc_stack.ss_size = SIGSTKSZ;
         native_isr_context.uc_stack.ss_flags = 0;
         makecontext(&native_isr_context, isr_thread_yield, 0);
-        if (swapcontext(ctx, &native_isr_context) == -1) {
+        if (_native_swapcontext(ctx, &native_isr_context) == -1) {
             err(EXIT_FAILURE, "thread_yield_higher: swapcontext");
         }
         irq_enable();
@@ -93,10 +93,27 @@ static inline int _set_promiscous(netdev2_t *netdev, int value)
     return value;
 }
 
+static void _continue_reading(netdev2_tap_t *dev);
+
 static inline void _isr(netdev2_t *netdev)
 {
     if (netdev->event_callback) {
+#ifdef MODULE_NETDEV2_TAP_BATCH
+        netdev2_tap_t *dev = (netdev2_tap_t*)netdev;
+        unsigned burst = 0;
+
+        /* _recv() sets rx_drained once the tap fd returns EAGAIN */
+        dev->rx_drained = false;
+        do {
+            netdev->event_callback(netdev, NETDEV2_EVENT_RX_COMPLETE);
+        } while (!dev->rx_drained && (++burst < NETDEV2_TAP_RX_BURST));
+
+        if (!dev->rx_drained) {
+            _continue_reading(dev);
+        }
+#else
         netdev->event_callback(netdev, NETDEV2_EVENT_RX_COMPLETE);
+#endif
     }
 #if DEVELHELP
     else {
@@ -209,6 +226,15 @@ static void _continue_reading(netdev2_tap_t *dev)
     _native_in_syscall--;
 }
 
+#ifdef MODULE_NETDEV2_TAP_BATCH
+static void _rx_drained(netdev2_tap_t *dev)
+{
+    DEBUG("netdev2_tap: drained\n");
+    dev->rx_drained = true;
+    native_async_read_continue(dev->tap_fd);
+}
+#endif
+
 static int _recv(netdev2_t *netdev2, void *buf, size_t len, void *info)
 {
     netdev2_tap_t *dev = (netdev2_tap_t*)netdev2;
@@ -229,9 +255,15 @@ static int _recv(netdev2_t *netdev2, void *buf, size_t len, void *info)
 
             static uint8_t buf[ETHERNET_FRAME_LEN];
 
+#ifdef MODULE_NETDEV2_TAP_BATCH
+            if (real_read(dev->tap_fd, buf, sizeof(buf)) <= 0) {
+                _rx_drained(dev);
+            }
+#else
             real_read(dev->tap_fd, buf, sizeof(buf));
 
             _continue_reading(dev);
+#endif
         }
 
         /* no way of figuring out packet size without racey buffering,
@@ -252,12 +284,17 @@ static int _recv(netdev2_t *netdev2, void *buf, size_t len, void *info)
                   hdr->dst[0], hdr->dst[1], hdr->dst[2],
                   hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
+#ifndef MODULE_NETDEV2_TAP_BATCH
             native_async_read_continue(dev->tap_fd);
+#endif
 
             return 0;
         }
 
+#ifndef MODULE_NETDEV2_TAP_BATCH
+        /* with batching _isr() keeps reading until the fd is drained */
         _continue_reading(dev);
+#endif
 
 #ifdef MODULE_NETSTATS_L2
         netdev2->stats.rx_count++;
@@ -267,6 +304,9 @@ static int _recv(netdev2_t *netdev2, void *buf, size_t len, void *info)
     }
     else if (nread == -1) {
         if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+#ifdef MODULE_NETDEV2_TAP_BATCH
+            _rx_drained(dev);
+#endif
         }
         else {
             err(EXIT_FAILURE, "netdev2_tap: read");
@@ -274,6 +314,9 @@ static int _recv(netdev2_t *netdev2, void *buf, size_t len, void *info)
     }
     else if (nread == 0) {
         DEBUG("_native_handle_tap_input: ignoring null-event\n");
+#ifdef MODULE_NETDEV2_TAP_BATCH
+        _rx_drained(dev);
+#endif
     }
     else {
         errx(EXIT_FAILURE, "internal error _rx_event");
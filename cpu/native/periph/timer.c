@@ -56,6 +56,12 @@ static void *_cb_arg;
 
 static struct itimerval itv;
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+/* virtual time the timer is due at, idle instances jump there */
+static uint64_t _deadline = NATIVE_VTIME_NONE;
+
+static void do_timer_set(unsigned int offset);
+#else
 /**
  * returns ticks for give timespec
  */
@@ -64,6 +70,7 @@ static unsigned long ts2ticks(struct timespec *tp)
     /* TODO: check for overflow */
     return((tp->tv_sec * NATIVE_TIMER_SPEED) + (tp->tv_nsec / 1000));
 }
+#endif
 
 /**
  * native timer signal handler
@@ -74,6 +81,23 @@ void native_isr_timer(void)
 {
     DEBUG("%s\n", __func__);
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    /* instances sharing the clock signal each other whenever it jumped,
+     * only fire if this timer is actually due */
+    if (_deadline == NATIVE_VTIME_NONE) {
+        return;
+    }
+    _native_syscall_enter();
+    uint64_t now = _native_vtime_now();
+    _native_syscall_leave();
+    if (now < _deadline) {
+        do_timer_set(_deadline - now);
+        return;
+    }
+    _deadline = NATIVE_VTIME_NONE;
+    _native_vtime_arm(_deadline);
+#endif
+
     _callback(_cb_arg, 0);
 }
 
@@ -118,6 +142,10 @@ static void do_timer_set(unsigned int offset)
     if (real_setitimer(ITIMER_REAL, &itv, NULL) == -1) {
         err(EXIT_FAILURE, "timer_arm: setitimer");
     }
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    _deadline = offset ? (_native_vtime_now() + offset) : NATIVE_VTIME_NONE;
+    _native_vtime_arm(_deadline);
+#endif
     _native_syscall_leave();
 }
 
@@ -197,10 +225,17 @@ unsigned int timer_read(tim_t dev)
         return 0;
     }
 
-    struct timespec t;
-
     DEBUG("timer_read()\n");
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    _native_syscall_enter();
+    uint64_t now = _native_vtime_now();
+    _native_syscall_leave();
+
+    return (unsigned int)now - time_null;
+#else
+    struct timespec t;
+
     _native_syscall_enter();
 #ifdef __MACH__
     clock_serv_t cclock;
@@ -220,4 +255,5 @@ unsigned int timer_read(tim_t dev)
     _native_syscall_leave();
 
     return ts2ticks(&t) - time_null;
+#endif
 }
@@ -202,7 +202,11 @@ void usage_exit(void)
     real_printf(" <tap interface>");
 #endif
 
-    real_printf(" [-i <id>] [-d] [-e|-E] [-o] [-c <tty device>]\n");
+    real_printf(" [-i <id>] [-d] [-e|-E] [-o] [-c <tty device>]");
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    real_printf(" [-t <clock file>]");
+#endif
+    real_printf("\n");
 
     real_printf(" help: %s -h\n", _progname);
 
@@ -220,6 +224,10 @@ void usage_exit(void)
 -o          redirect stdout to file (/tmp/riot.stdout.PID) when not attached\n\
             to socket\n\
 -c          specify TTY device for UART\n");
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    real_printf("\
+-t          share the virtual clock with all instances using the same file\n");
+#endif
 
     real_printf("\n\
 The order of command line arguments matters.\n");
@@ -243,6 +251,9 @@ __attribute__((constructor)) static void startup(int argc, char **argv)
     char *stdouttype = "stdio";
     char *stdiotype = "stdio";
     int uart = 0;
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    char *vtime_path = NULL;
+#endif
 
 #if defined(MODULE_NETDEV2_TAP)
     if (
@@ -311,6 +322,17 @@ __attribute__((constructor)) static void startup(int argc, char **argv)
 
             tty_uart_setup(uart++, argv[argp]);
         }
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+        else if (strcmp("-t", arg) == 0) {
+            if (argp + 1 < argc) {
+                argp++;
+            }
+            else {
+                usage_exit();
+            }
+            vtime_path = argv[argp];
+        }
+#endif
         else {
             usage_exit();
         }
@@ -324,6 +346,10 @@ __attribute__((constructor)) static void startup(int argc, char **argv)
     _native_log_stdout(stdouttype);
     _native_null_in(stdiotype);
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    _native_vtime_init(vtime_path);
+#endif
+
     native_cpu_init();
     native_interrupt_init();
 #ifdef MODULE_NETDEV2_TAP
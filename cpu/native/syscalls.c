@@ -126,7 +126,7 @@ void _native_syscall_leave(void)
         native_isr_context.uc_stack.ss_flags = 0;
         native_interrupts_enabled = 0;
         makecontext(&native_isr_context, native_irq_handler, 0);
-        if (swapcontext(_native_cur_ctx, &native_isr_context) == -1) {
+        if (_native_swapcontext(_native_cur_ctx, &native_isr_context) == -1) {
             err(EXIT_FAILURE, "_native_syscall_leave: swapcontext");
         }
     }
@@ -0,0 +1,225 @@
+/**
+ * Virtual time for native
+ *
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ *
+ * @ingroup native_cpu
+ * @{
+ * @file
+ * @brief   Skips idle time of one or more native instances
+ *
+ * The virtual clock runs at the speed of the host's monotonic clock, plus
+ * all the time skipped so far. Once every instance sharing the clock is idle,
+ * i.e. waits in lpm_set() without a pending signal, the clock jumps to the
+ * earliest timer armed by any of them. All idle instances then get a
+ * SIGALRM, so the due timers fire and the others are rearmed for the
+ * shortened time left.
+ * @}
+ */
+
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+
+#ifdef __MACH__
+#error "native_virtual_time is not available on OS X"
+#endif
+
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "native_internal.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/**
+ * @brief   State of one instance sharing the clock
+ */
+typedef struct {
+    volatile pid_t pid;     /**< process of the instance, 0 if unused */
+    volatile int idle;      /**< instance waits for a signal */
+    uint64_t deadline;      /**< virtual time of its armed timer */
+} _instance_t;
+
+/**
+ * @brief   Clock shared by all instances mapping the same file
+ */
+typedef struct {
+    volatile int lock;      /**< protects the instances' idle states */
+    uint64_t skipped;       /**< time skipped so far in us */
+    _instance_t instances[NATIVE_VTIME_INSTANCES];
+} _vclock_t;
+
+static _vclock_t _local;
+static _vclock_t *_vclock = &_local;
+static _instance_t *_self;
+
+static void _lock(void)
+{
+    while (__sync_lock_test_and_set(&_vclock->lock, 1)) {}
+}
+
+static void _unlock(void)
+{
+    __sync_lock_release(&_vclock->lock);
+}
+
+static int _alive(_instance_t *instance)
+{
+    if ((kill(instance->pid, 0) == -1) && (errno == ESRCH)) {
+        /* the instance died without leaving */
+        instance->pid = 0;
+        return 0;
+    }
+    return 1;
+}
+
+static void _leave(void)
+{
+    _lock();
+    _self->pid = 0;
+    _unlock();
+}
+
+/**
+ * @brief   Jumps to the earliest deadline if all instances are idle
+ *
+ * Must be called with the clock locked.
+ */
+static void _advance(void)
+{
+    uint64_t next = NATIVE_VTIME_NONE;
+
+    for (unsigned i = 0; i < NATIVE_VTIME_INSTANCES; i++) {
+        _instance_t *instance = &_vclock->instances[i];
+
+        if (instance->pid == 0) {
+            continue;
+        }
+        if (!instance->idle) {
+            if (_alive(instance)) {
+                return;
+            }
+            continue;
+        }
+        uint64_t deadline = __atomic_load_n(&instance->deadline, __ATOMIC_ACQUIRE);
+        if (deadline < next) {
+            next = deadline;
+        }
+    }
+    if (next == NATIVE_VTIME_NONE) {
+        /* nothing will ever happen without outside input */
+        return;
+    }
+
+    uint64_t now = _native_vtime_now();
+    if (next > now) {
+        DEBUG("_advance: skipping %" PRIu64 " us\n", next - now);
+        __atomic_fetch_add(&_vclock->skipped, next - now, __ATOMIC_RELEASE);
+    }
+
+    for (unsigned i = 0; i < NATIVE_VTIME_INSTANCES; i++) {
+        _instance_t *instance = &_vclock->instances[i];
+
+        if ((instance->pid != 0) && instance->idle &&
+            (kill(instance->pid, SIGALRM) == -1) && (errno == ESRCH)) {
+            instance->pid = 0;
+        }
+    }
+}
+
+void _native_vtime_init(const char *path)
+{
+    if (path != NULL) {
+        int fd = real_open(path, O_RDWR | O_CREAT, 0600);
+        if (fd == -1) {
+            err(EXIT_FAILURE, "_native_vtime_init: open");
+        }
+        /* a new file is zero filled, which is a valid clock */
+        if (ftruncate(fd, sizeof(_vclock_t)) == -1) {
+            err(EXIT_FAILURE, "_native_vtime_init: ftruncate");
+        }
+        _vclock = mmap(NULL, sizeof(_vclock_t), PROT_READ | PROT_WRITE,
+                       MAP_SHARED, fd, 0);
+        if (_vclock == MAP_FAILED) {
+            err(EXIT_FAILURE, "_native_vtime_init: mmap");
+        }
+        real_close(fd);
+    }
+
+    _lock();
+    for (unsigned i = 0; i < NATIVE_VTIME_INSTANCES; i++) {
+        _instance_t *instance = &_vclock->instances[i];
+
+        if ((instance->pid == 0) || !_alive(instance)) {
+            instance->idle = 0;
+            __atomic_store_n(&instance->deadline, NATIVE_VTIME_NONE,
+                             __ATOMIC_RELEASE);
+            instance->pid = _native_pid;
+            _self = instance;
+            break;
+        }
+    }
+    _unlock();
+
+    if (_self == NULL) {
+        errx(EXIT_FAILURE, "_native_vtime_init: more than %u instances share %s",
+             NATIVE_VTIME_INSTANCES, path);
+    }
+    atexit(_leave);
+}
+
+uint64_t _native_vtime_now(void)
+{
+    struct timespec t;
+
+    if (real_clock_gettime(CLOCK_MONOTONIC, &t) == -1) {
+        err(EXIT_FAILURE, "_native_vtime_now: clock_gettime");
+    }
+    return ((uint64_t)t.tv_sec * 1000000) + (t.tv_nsec / 1000) +
+           __atomic_load_n(&_vclock->skipped, __ATOMIC_ACQUIRE);
+}
+
+void _native_vtime_arm(uint64_t deadline)
+{
+    __atomic_store_n(&_self->deadline, deadline, __ATOMIC_RELEASE);
+}
+
+void _native_vtime_sleep(void)
+{
+    sigset_t all, old;
+
+    /* a SIGALRM of another instance must not get lost between checking for
+     * pending signals and waiting for them */
+    sigfillset(&all);
+    if (sigprocmask(SIG_SETMASK, &all, &old) == -1) {
+        err(EXIT_FAILURE, "_native_vtime_sleep: sigprocmask");
+    }
+
+    _lock();
+    _self->idle = 1;
+    _advance();
+    _unlock();
+
+    if (_native_sigpend == 0) {
+        sigsuspend(&old);
+    }
+    _self->idle = 0;
+
+    if (sigprocmask(SIG_SETMASK, &old, NULL) == -1) {
+        err(EXIT_FAILURE, "_native_vtime_sleep: sigprocmask");
+    }
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_NATIVE_VIRTUAL_TIME */
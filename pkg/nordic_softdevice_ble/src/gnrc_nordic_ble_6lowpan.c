@@ -237,6 +237,7 @@ static void *_gnrc_nordic_ble_6lowpan_thread(void *args)
     gnrc_nordic_ble_6lowpan_pid = thread_getpid();
 
     gnrc_netapi_opt_t *opt;
+    gnrc_netapi_opts_t *opts;
     int res;
     msg_t msg, reply, msg_queue[BLE_NETAPI_MSG_QUEUE_SIZE];
 
@@ -299,6 +300,23 @@ static void *_gnrc_nordic_ble_6lowpan_thread(void *args)
                 reply.content.value = (uint32_t)res;
                 msg_reply(&msg, &reply);
                 break;
+            case GNRC_NETAPI_MSG_TYPE_OPTS:
+                /* read incoming option requests */
+                opts = msg.content.ptr;
+                DEBUG("gnrc_nordic_ble_6lowpan: GNRC_NETAPI_MSG_TYPE_OPTS received. numof=%u\n",
+                      opts->numof);
+                for (unsigned i = 0; i < opts->numof; i++) {
+                    gnrc_netapi_opt_req_t *req = &opts->reqs[i];
+
+                    /* setting options is not supported, see above */
+                    req->res = (req->type == GNRC_NETAPI_MSG_TYPE_GET) ?
+                               _handle_get(&req->opt) : ENOTSUP;
+                }
+                /* send reply to calling thread */
+                reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
+                reply.content.value = (uint32_t)opts->numof;
+                msg_reply(&msg, &reply);
+                break;
             default:
                 DEBUG("gnrc_nordic_ble_6lowpan: Unknown command %" PRIu16 "\n", msg.type);
                 break;
@@ -11,6 +11,16 @@
  * @ingroup     net
  * @brief       FIB implementation
  *
+ * The single hop entries of a table are kept sorted by their (masked) prefix.
+ * Each entry is linked to the nearest preceding entry enclosing it, so a
+ * longest prefix match is a binary search followed by a walk up these links,
+ * which is bounded by the prefix length instead of the table size. Adding or
+ * removing an entry is linear in the number of used entries.
+ *
+ * Expired entries are not checked on every lookup. Instead a timer set to the
+ * earliest expiring entry flags the table and the next access to it removes
+ * all expired entries.
+ *
  * @{
  *
  * @file
@@ -465,6 +475,22 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
  */
 int fib_get_num_used_entries(fib_table_t *table);
 
+/**
+ * @brief returns the generation of a FIB table
+ *
+ * The generation changes whenever an entry is added, updated or removed, and
+ * when an entry expires. Users caching the results of lookups can compare it
+ * to the generation read before the lookups to tell whether these are still
+ * valid.
+ *
+ * May be called from any thread.
+ *
+ * @param[in] table         the fib instance to check
+ *
+ * @return the current generation of @p table
+ */
+unsigned fib_get_generation(fib_table_t *table);
+
 /**
  * @brief Prints the kernel_pid_t for all registered RRPs
  */
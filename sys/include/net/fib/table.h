@@ -24,6 +24,7 @@
 #include "kernel_types.h"
 #include "universal_address.h"
 #include "mutex.h"
+#include "xtimer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,12 +36,22 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+/**
+ * @brief marks an entry without an enclosing prefix entry in the lookup index
+ */
+#define FIB_ENTRY_NO_PARENT (UINT16_MAX)
+
 /**
  * @brief Container descriptor for a FIB entry
  */
 typedef struct {
     /** interface ID */
     kernel_pid_t iface_id;
+    /** number of significant bits of the global address, 0 for a default route */
+    uint16_t prefix_len;
+    /** index of the nearest preceding entry whose prefix encloses this one,
+     *  @ref FIB_ENTRY_NO_PARENT if there is none */
+    uint16_t parent;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
     uint64_t lifetime;
     /** Unique identifier for the type of the global address */
@@ -119,6 +130,19 @@ typedef struct {
     uint8_t table_type;
     /** the maximim number of entries in this FIB table */
     size_t size;
+    /** the number of used single hop entries.
+    *   They are kept at the start of `data.entries`, ordered by their prefix
+    */
+    size_t used;
+    /** timer firing on the earliest expiring single hop entry */
+    xtimer_t lifetime_timer;
+    /** the absolute time-point the lifetime timer is set to */
+    uint64_t next_expiry;
+    /** set by the lifetime timer, the next access removes expired entries */
+    volatile uint8_t lifetime_expired;
+    /** incremented on every change that may alter the result of a lookup,
+     *  see fib_get_generation() */
+    volatile unsigned generation;
     /** table access mutex to grant exclusive operations on calls */
     mutex_t mtx_access;
     /** current number of registered RPs. */
@@ -31,6 +31,22 @@
  * gcoap itself defines a resource for `/.well-known/core` discovery, which
  * lists all of the registered paths.
  *
+ * By default gcoap looks up the resource for a request by walking the
+ * resources of all listeners. With the (pseudo) module `gcoap_resource_index`
+ * gcoap_register_listener() adds the resources to a hash table by path
+ * instead, so finding a resource does not depend on how many of them are
+ * registered. Set GCOAP_RESOURCES_MAX to the number of resources to size the
+ * table. It holds up to GCOAP_RESOURCE_INDEX_SIZE - 1 resources; if more are
+ * registered, gcoap falls back to walking the listeners.
+ *
+ * Likewise gcoap matches a response to its request by walking all open
+ * requests. With the (pseudo) module `gcoap_req_index` the open requests are
+ * kept in a hash table by token instead, and free request memos in a list, so
+ * neither sending a request nor matching a response depends on
+ * GCOAP_REQ_WAITING_MAX. Together with a larger GCOAP_REQ_WAITING_MAX this
+ * allows a client to keep hundreds of requests open; use a longer
+ * GCOAP_TOKENLEN then, so the random tokens of open requests do not collide.
+ *
  * ### Creating a response ###
  *
  * An application resource includes a callback function, a coap_handler_t. After
@@ -88,11 +104,20 @@
  * Finally, call gcoap_req_send() with the destination host and port, as well
  * as a callback function for the host's response.
  *
+ * A request is non-confirmable by default. To send it confirmable, call
+ * gcoap_hdr_set_type() with COAP_TYPE_CON on the request header before
+ * gcoap_req_send(). With the (pseudo) module `gcoap_con` gcoap then
+ * retransmits the request with exponential back-off, starting at
+ * GCOAP_ACK_TIMEOUT, until it receives the response or an empty ACK, at most
+ * GCOAP_MAX_RETRANSMIT times. Without it, a confirmable request is sent only
+ * once and waits for its response like a non-confirmable one.
+ *
  * ### Handling the response ###
  *
  * When gcoap receives the response to a request, it executes the callback from
  * the request. gcoap also executes the callback when a response is not
- * received within GCOAP_RESPONSE_TIMEOUT.
+ * received within GCOAP_NON_TIMEOUT, or, for a confirmable request with
+ * `gcoap_con`, after the last retransmission.
  *
  * Here is the expected sequence for handling a response in the callback.
  *
@@ -122,7 +147,9 @@
  * response, so the gcoap thread does not block while waiting. The user is
  * notified via the same callback whether the message is received or the wait
  * times out. We track the response with an entry in the
- * `_coap_state.open_reqs` array.
+ * `_coap_state.open_reqs` array. With `gcoap_con` the same xtimer drives
+ * retransmission of a confirmable request, which is kept in the packet buffer
+ * until then.
  *
  * @{
  *
@@ -145,8 +172,10 @@
 extern "C" {
 #endif
 
-/** @brief Size for module message queue */
+/** @brief Size for module message queue; must be a power of two */
+#ifndef GCOAP_MSG_QUEUE_SIZE
 #define GCOAP_MSG_QUEUE_SIZE (4)
+#endif
 
 /** @brief Server port; use RFC 7252 default if not defined */
 #ifndef GCOAP_PORT
@@ -171,8 +200,60 @@ extern "C" {
  */
 #define GCOAP_RESP_OPTIONS_BUF  (8)
 
-/** @brief Maximum number of requests awaiting a response */
+/**
+ * @brief   Maximum number of resources the application registers
+ *
+ * Counts the resources of all listeners passed to gcoap_register_listener(),
+ * plus one for gcoap's own `/.well-known/core`. Only used to size the
+ * resource index of `gcoap_resource_index`.
+ */
+#ifndef GCOAP_RESOURCES_MAX
+#define GCOAP_RESOURCES_MAX         (32U)
+#endif
+
+/**
+ * @brief   Number of slots in the resource index of `gcoap_resource_index`
+ *
+ * Must be a power of two. Lookups stay fast as long as at most about half of
+ * the slots are used, so this defaults to the smallest of 64, 256, 1024 and
+ * 4096 that is at least twice GCOAP_RESOURCES_MAX.
+ */
+#ifndef GCOAP_RESOURCE_INDEX_SIZE
+#if GCOAP_RESOURCES_MAX <= 32
+#define GCOAP_RESOURCE_INDEX_SIZE   (64U)
+#elif GCOAP_RESOURCES_MAX <= 128
+#define GCOAP_RESOURCE_INDEX_SIZE   (256U)
+#elif GCOAP_RESOURCES_MAX <= 512
+#define GCOAP_RESOURCE_INDEX_SIZE   (1024U)
+#else
+#define GCOAP_RESOURCE_INDEX_SIZE   (4096U)
+#endif
+#endif
+
+/**
+ * @brief Maximum number of requests awaiting a response
+ *
+ * At most 255, as gcoap_op_state() counts them in a uint8_t.
+ */
+#ifndef GCOAP_REQ_WAITING_MAX
 #define GCOAP_REQ_WAITING_MAX   (2)
+#endif
+
+/**
+ * @brief   Number of buckets in the request index of `gcoap_req_index`
+ *
+ * Must be a power of two. Defaults to the smallest of 16, 64 and 256 that is
+ * not less than GCOAP_REQ_WAITING_MAX, so buckets hold about one open request.
+ */
+#ifndef GCOAP_REQ_INDEX_SIZE
+#if GCOAP_REQ_WAITING_MAX <= 16
+#define GCOAP_REQ_INDEX_SIZE    (16U)
+#elif GCOAP_REQ_WAITING_MAX <= 64
+#define GCOAP_REQ_INDEX_SIZE    (64U)
+#else
+#define GCOAP_REQ_INDEX_SIZE    (256U)
+#endif
+#endif
 
 /** @brief Maximum length in bytes for a token */
 #define GCOAP_TOKENLEN_MAX      (8)
@@ -204,7 +285,34 @@ extern "C" {
  *
  * Set to 0 to disable timeout.
  */
+#ifndef GCOAP_NON_TIMEOUT
 #define GCOAP_NON_TIMEOUT    (5000000U)
+#endif
+
+/**
+ * @brief Minimum time to wait for the response to a confirmable request before
+ *        the first retransmission, in usec
+ *
+ * ACK_TIMEOUT of RFC 7252. The time doubles with each retransmission.
+ */
+#ifndef GCOAP_ACK_TIMEOUT
+#define GCOAP_ACK_TIMEOUT    (2000000U)
+#endif
+
+/**
+ * @brief Maximum random time added to GCOAP_ACK_TIMEOUT for the first
+ *        retransmission, in usec
+ *
+ * Corresponds to an ACK_RANDOM_FACTOR of 1.5 in RFC 7252.
+ */
+#ifndef GCOAP_ACK_TIMEOUT_RANDOM
+#define GCOAP_ACK_TIMEOUT_RANDOM    (GCOAP_ACK_TIMEOUT / 2)
+#endif
+
+/** @brief Maximum number of retransmissions of a confirmable request */
+#ifndef GCOAP_MAX_RETRANSMIT
+#define GCOAP_MAX_RETRANSMIT (4)
+#endif
 
 /** @brief Identifies a gcoap-specific timeout IPC message */
 #define GCOAP_NETAPI_MSG_TYPE_TIMEOUT    (0x1501)
@@ -230,13 +338,30 @@ typedef void (*gcoap_resp_handler_t)(unsigned req_state, coap_pkt_t* pdu);
 /**
  * @brief  Memo to handle a response for a request
  */
-typedef struct {
+typedef struct gcoap_request_memo {
     unsigned state;                     /**< State of this memo, a GCOAP_MEMO... */
     uint8_t hdr_buf[GCOAP_HEADER_MAXLEN];
                                         /**< Stores a copy of the request header */
     gcoap_resp_handler_t resp_handler;  /**< Callback for the response */
     xtimer_t response_timer;            /**< Limits wait for response */
     msg_t timeout_msg;                  /**< For response timer */
+#ifdef MODULE_GCOAP_CON
+    gnrc_pktsnip_t *resend_pkt;         /**< Confirmable request to retransmit;
+                                             NULL if none */
+    ipv6_addr_t remote_addr;            /**< Destination of the request */
+    uint16_t remote_port;               /**< Destination port of the request */
+    uint8_t send_limit;                 /**< Retransmissions left */
+    uint32_t resend_timeout;            /**< Time to wait for the response to
+                                             the last transmission, in usec */
+#endif
+#ifdef MODULE_GCOAP_REQ_INDEX
+    struct gcoap_request_memo *next;    /**< Next memo in the same index bucket,
+                                             or in the list of free memos */
+#ifdef MODULE_GCOAP_CON
+    struct gcoap_request_memo *con_next;    /**< Next memo in the same bucket
+                                                 of requests awaiting an ACK */
+#endif
+#endif
 } gcoap_request_memo_t;
 
 /**
@@ -322,9 +447,26 @@ static inline ssize_t gcoap_request(coap_pkt_t *pdu, uint8_t *buf, size_t len,
                 : -1;
 }
 
+/**
+ * @brief  Sets the message type of a CoAP PDU.
+ *
+ * Use with COAP_TYPE_CON on a request initialized with gcoap_req_init() or
+ * gcoap_request() to send it confirmable.
+ *
+ * @param[in] hdr   Header of the PDU
+ * @param[in] type  Message type, a COAP_TYPE...
+ */
+static inline void gcoap_hdr_set_type(coap_hdr_t *hdr, unsigned type)
+{
+    hdr->ver_t_tkl = (hdr->ver_t_tkl & ~0x30) | ((type & 0x3) << 4);
+}
+
 /**
  * @brief  Sends a buffer containing a CoAP request to the provided host/port.
  *
+ * With `gcoap_con`, a confirmable request is retransmitted until the response
+ * or an empty ACK arrives, see GCOAP_MAX_RETRANSMIT.
+ *
  * @param[in] buf Buffer containing the PDU
  * @param[in] len Length of the buffer
  * @param[in] addr Destination for the packet
@@ -16,6 +16,12 @@
  *  * @ref GNRC_NETAPI_MSG_TYPE_RCV, and
  *  * @ref GNRC_NETAPI_MSG_TYPE_SND,
  *
+ * Packets to the loopback address or to an address of this node are copied
+ * into a single snip and handed back to the receive path. With the
+ * `gnrc_ipv6_loopback_zerocopy` module the snips of the packet are handed back
+ * instead, so e.g. local UDP services talking to each other do not pay for a
+ * copy of every message. Only a payload spread over several snips is merged.
+ *
  * @{
  *
  * @file
@@ -34,6 +40,7 @@
 #include "thread.h"
 
 #include "net/ipv6.h"
+#include "net/gnrc/ipv6/dst_cache.h"
 #include "net/gnrc/ipv6/ext.h"
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/ipv6/nc.h"
@@ -68,6 +75,16 @@ extern "C" {
 #define GNRC_IPV6_MSG_QUEUE_SIZE    (8U)
 #endif
 
+/**
+ * @brief   Maximum number of messages the IPv6 thread takes out of its message
+ *          queue at once.
+ *
+ * @see msg_receive_bulk()
+ */
+#ifndef GNRC_IPV6_MSG_BULK_SIZE
+#define GNRC_IPV6_MSG_BULK_SIZE     (4U)
+#endif
+
 /**
  * @brief   The PID to the IPv6 thread.
  *
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_ipv6_dst_cache  IPv6 destination cache
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Remembers how recently used destinations were reached
+ *
+ * A destination cache in the sense of
+ * <a href="https://tools.ietf.org/html/rfc4861#section-5.1">
+ *     RFC 4861, section 5.1
+ * </a>: For every unicast destination IPv6 sent to recently, it keeps the
+ * interface, the link layer address of the next hop and the source address
+ * selected for it, so following packets to that destination skip the
+ * interface, neighbor cache and FIB lookups.
+ *
+ * All entries are invalidated at once by gnrc_ipv6_dst_cache_flush(), which
+ * the neighbor cache, neighbor discovery and the IPv6 interfaces call
+ * whenever they change anything that could affect the outcome of these
+ * lookups. Changes to the FIB are picked up by comparing its generation (see
+ * fib_get_generation()) on every access, so the FIB does not depend on GNRC.
+ * Apart from that, the cache is only used by the IPv6 thread.
+ * @{
+ *
+ * @file
+ * @brief       IPv6 destination cache definitions
+ */
+#ifndef GNRC_IPV6_DST_CACHE_H_
+#define GNRC_IPV6_DST_CACHE_H_
+
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/nc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of entries in the destination cache
+ */
+#ifndef GNRC_IPV6_DST_CACHE_SIZE
+#define GNRC_IPV6_DST_CACHE_SIZE    (4)
+#endif
+
+/**
+ * @brief   Destination cache entry
+ */
+typedef struct {
+    ipv6_addr_t dst;        /**< destination address */
+    ipv6_addr_t src;        /**< selected source address; unspecified if
+                             *   none was selected */
+    unsigned gen;           /**< generation the entry is valid for */
+    kernel_pid_t req_iface; /**< interface the destination was requested for;
+                             *   KERNEL_PID_UNDEF for any */
+    kernel_pid_t iface;     /**< interface to send over */
+    uint8_t l2addr_len;     /**< length of gnrc_ipv6_dst_cache_t::l2addr */
+    /**
+     * @brief   link layer address of the next hop
+     */
+    uint8_t l2addr[GNRC_IPV6_NC_L2_ADDR_MAX];
+} gnrc_ipv6_dst_cache_t;
+
+/**
+ * @brief   Gets the current generation of the cache
+ *
+ * Must be read before doing the lookups whose results are added with
+ * gnrc_ipv6_dst_cache_add(), so the entry is not valid if the cache was
+ * flushed in between.
+ *
+ * @return  The current generation.
+ */
+unsigned gnrc_ipv6_dst_cache_gen(void);
+
+/**
+ * @brief   Gets the entry for a destination
+ *
+ * @param[in] iface The interface the destination is requested for.
+ *                  KERNEL_PID_UNDEF for any.
+ * @param[in] dst   A unicast destination address.
+ *
+ * @return  The valid entry for @p dst and @p iface.
+ * @return  NULL, if there is none.
+ */
+gnrc_ipv6_dst_cache_t *gnrc_ipv6_dst_cache_get(kernel_pid_t iface,
+                                               const ipv6_addr_t *dst);
+
+/**
+ * @brief   Adds an entry for a destination, replacing the least recently
+ *          added one if the cache is full
+ *
+ * @param[in] gen           Generation read by gnrc_ipv6_dst_cache_gen() before
+ *                          the lookups.
+ * @param[in] req_iface     The interface the destination was requested for.
+ *                          KERNEL_PID_UNDEF for any.
+ * @param[in] dst           A unicast destination address.
+ * @param[in] iface         The interface to send over.
+ * @param[in] l2addr        Link layer address of the next hop.
+ * @param[in] l2addr_len    Length of @p l2addr. Must not exceed
+ *                          GNRC_IPV6_NC_L2_ADDR_MAX.
+ * @param[in] src           The selected source address. NULL if none was
+ *                          selected.
+ */
+void gnrc_ipv6_dst_cache_add(unsigned gen, kernel_pid_t req_iface,
+                             const ipv6_addr_t *dst, kernel_pid_t iface,
+                             const uint8_t *l2addr, uint8_t l2addr_len,
+                             const ipv6_addr_t *src);
+
+/**
+ * @brief   Invalidates all entries
+ *
+ * May be called from any thread.
+ */
+void gnrc_ipv6_dst_cache_flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_IPV6_DST_CACHE_H_ */
+/** @} */
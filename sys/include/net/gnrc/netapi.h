@@ -51,6 +51,39 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_ring   Packet ring extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Batched packet delivery for @ref net_gnrc_netapi
+ * @{
+ * @details The submodule `gnrc_netapi_ring` lets a subscriber register a
+ *          @ref gnrc_netapi_ring_t instead of its PID. Dispatched packets
+ *          are then put into the ring and the subscriber is woken up with a
+ *          @ref core_thread_flags "thread flag" instead of one message per
+ *          packet, so it can take all pending packets after a single context
+ *          switch:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * while (1) {
+ *     msg_t msg;
+ *
+ *     thread_flags_wait_any(RING_FLAG);
+ *     while (gnrc_netapi_ring_get(&ring, &msg)) {
+ *         handle(msg.type, msg.content.ptr);
+ *     }
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Any number of threads may dispatch into a ring, but only the thread that
+ * initialized it may take packets out of it.
+ *
+ * To use, add the module `gnrc_netapi_ring` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_ring
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  * @author      Martine Lenders <mlenders@inf.fu-berlin.de>
  * @author      Hauke Petersen <hauke.petersen@fu-berlin.de>
  */
@@ -92,6 +125,16 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for getting and setting several options of
+ *          network modules at once
+ *
+ * The message's content is a pointer to a @ref gnrc_netapi_opts_t. The
+ * replying @ref GNRC_NETAPI_MSG_TYPE_ACK message carries the number of
+ * processed requests, the individual results are stored in the requests.
+ */
+#define GNRC_NETAPI_MSG_TYPE_OPTS       (0x0206)
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -103,6 +146,73 @@ typedef struct {
     uint16_t data_len;          /**< size of the data / the buffer */
 } gnrc_netapi_opt_t;
 
+/**
+ * @brief   A single get or set request of a @ref GNRC_NETAPI_MSG_TYPE_OPTS
+ *          batch
+ */
+typedef struct {
+    uint16_t type;              /**< @ref GNRC_NETAPI_MSG_TYPE_GET or
+                                 *   @ref GNRC_NETAPI_MSG_TYPE_SET */
+    gnrc_netapi_opt_t opt;      /**< the option to get/set */
+    int res;                    /**< result as it would have been returned by
+                                 *   gnrc_netapi_get() or gnrc_netapi_set() */
+} gnrc_netapi_opt_req_t;
+
+/**
+ * @brief   Data structure to be send for batched getting and setting
+ *          (@ref GNRC_NETAPI_MSG_TYPE_OPTS) of options
+ */
+typedef struct {
+    gnrc_netapi_opt_req_t *reqs;    /**< the requests, processed in order */
+    unsigned numof;                 /**< number of requests in gnrc_netapi_opts_t::reqs */
+} gnrc_netapi_opts_t;
+
+#if defined(MODULE_GNRC_NETAPI_RING) || defined(DOXYGEN)
+/**
+ * @brief   Packet ring of a subscriber
+ *
+ * @note    Only available with @ref net_gnrc_netapi_ring.
+ */
+typedef struct {
+    volatile msg_t *buf;        /**< slots of the ring */
+    unsigned size;              /**< number of slots, a power of two */
+    volatile unsigned reads;    /**< total number of packets taken */
+    volatile unsigned writes;   /**< total number of packets put */
+    thread_t *thread;           /**< the consuming thread */
+    thread_flags_t flag;        /**< flag set on gnrc_netapi_ring_t::thread */
+} gnrc_netapi_ring_t;
+
+/**
+ * @brief   Initializes a packet ring for the calling thread
+ *
+ * @note    Only available with @ref net_gnrc_netapi_ring.
+ *
+ * @param[out] ring     The ring to initialize
+ * @param[in] buf       Slots for the ring
+ * @param[in] size      Number of slots in @p buf. Must be a power of two.
+ * @param[in] flag      Thread flag to set on the calling thread whenever a
+ *                      packet was put into @p ring
+ */
+void gnrc_netapi_ring_init(gnrc_netapi_ring_t *ring, msg_t *buf,
+                           unsigned size, thread_flags_t flag);
+
+/**
+ * @brief   Takes the oldest packet out of a packet ring
+ *
+ * @note    Only available with @ref net_gnrc_netapi_ring.
+ *
+ * @param[in] ring      The ring, must be called by the thread that
+ *                      initialized it
+ * @param[out] msg      The packet as message, msg_t::type is the command
+ *                      (e.g. @ref GNRC_NETAPI_MSG_TYPE_RCV) and
+ *                      msg_t::content::ptr the packet
+ *
+ * @return  1 if a packet was taken
+ * @return  0 if @p ring is empty
+ */
+int gnrc_netapi_ring_get(gnrc_netapi_ring_t *ring, msg_t *msg);
+#endif
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_SND messages
  *
@@ -206,6 +316,28 @@ int gnrc_netapi_get(kernel_pid_t pid, netopt_t opt, uint16_t context,
 int gnrc_netapi_set(kernel_pid_t pid, netopt_t opt, uint16_t context,
                     void *data, size_t data_len);
 
+/**
+ * @brief   Gets and sets several options of a network module in a single
+ *          @ref GNRC_NETAPI_MSG_TYPE_OPTS message exchange
+ *
+ * Compared to a sequence of gnrc_netapi_get() and gnrc_netapi_set() calls the
+ * caller only blocks for one round trip through the network module's thread.
+ * The requests are processed in the given order, so a request may depend on
+ * an option set by a preceding one.
+ *
+ * @pre The network module handles @ref GNRC_NETAPI_MSG_TYPE_OPTS. This is the
+ *      case for all network interfaces in this tree.
+ *
+ * @param[in] pid       PID of the targeted network module
+ * @param[in,out] reqs  the requests, the result of each request is stored in
+ *                      its gnrc_netapi_opt_req_t::res
+ * @param[in] numof     number of requests in @p reqs
+ *
+ * @return  number of processed requests, i.e. @p numof
+ */
+int gnrc_netapi_opts(kernel_pid_t pid, gnrc_netapi_opt_req_t *reqs,
+                     unsigned numof);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,14 @@
  * @defgroup    net_gnrc_netreg  Network protocol registry
  * @ingroup     net_gnrc
  * @brief       Registry to receive messages of a specified protocol type by GNRC.
+ *
+ * By default the registry keeps one list of entries per protocol type, so
+ * every lookup is linear in the number of entries registered for that type.
+ * With the (pseudo) module `gnrc_netreg_hash` the entries of every type are
+ * spread over @ref GNRC_NETREG_HASH_BUCKETS buckets by their
+ * gnrc_netreg_entry_t::demux_ctx and entries with equal demultiplexing
+ * context are kept adjacent. A lookup then only walks one (short) bucket and
+ * gnrc_netreg_getnext() is O(1).
  * @{
  *
  * @file
@@ -31,12 +39,16 @@
 #include "mbox.h"
 #endif
 
+#ifdef MODULE_GNRC_NETAPI_RING
+#include "net/gnrc/netapi.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_RING) || defined(DOXYGEN)
 typedef enum {
     GNRC_NETREG_TYPE_DEFAULT = 0,
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -45,9 +57,21 @@ typedef enum {
 #if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
     GNRC_NETREG_TYPE_CB,
 #endif
+#if defined(MODULE_GNRC_NETAPI_RING) || defined(DOXYGEN)
+    GNRC_NETREG_TYPE_RING,
+#endif
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @brief   Number of hash buckets per protocol type
+ *
+ * @note    Only used with `gnrc_netreg_hash`. Must be a power of two.
+ */
+#ifndef GNRC_NETREG_HASH_BUCKETS
+#define GNRC_NETREG_HASH_BUCKETS    (8U)
+#endif
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -64,12 +88,13 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#ifdef MODULE_GNRC_NETAPI_MBOX
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_RING)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
-                                                      { pid } }
+                                                      { pid }, 0 }
 #else
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid }, 0 }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -86,7 +111,7 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_MBOX(demux_ctx, mbox) { NULL, demux_ctx, \
                                                        GNRC_NETREG_TYPE_MBOX, \
-                                                       { .mbox = mbox } }
+                                                       { .mbox = mbox }, 0 }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
@@ -103,8 +128,28 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, cbd)   { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_CB, \
-                                                      { .cbd = cbd } }
+                                                      { .cbd = cbd }, 0 }
+#endif
 
+#if defined(MODULE_GNRC_NETAPI_RING) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry statically with packet ring
+ *
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] ring      Target @ref gnrc_netapi_ring_t "packet ring" for the
+ *                      registry entry
+ *
+ * @note    Only available with @ref net_gnrc_netapi_ring.
+ *
+ * @return  An initialized netreg entry
+ */
+#define GNRC_NETREG_ENTRY_INIT_RING(demux_ctx, ring) { NULL, demux_ctx, \
+                                                       GNRC_NETREG_TYPE_RING, \
+                                                       { .ring = ring }, 0 }
+#endif
+
+#if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
 /**
  * @brief   Packet handler callback for netreg entries with callback.
  *
@@ -151,12 +196,12 @@ typedef struct gnrc_netreg_entry {
      */
     uint32_t demux_ctx;
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_RING) || defined(DOXYGEN)
     /**
      * @brief   Type of the registry entry
      *
-     * @note    Only available with @ref net_gnrc_netapi_mbox or
-     *          @ref net_gnrc_netapi_callbacks.
+     * @note    Only available with @ref net_gnrc_netapi_mbox,
+     *          @ref net_gnrc_netapi_callbacks or @ref net_gnrc_netapi_ring.
      */
     gnrc_netreg_type_t type;
 #endif
@@ -179,7 +224,23 @@ typedef struct gnrc_netreg_entry {
          */
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
+
+#if defined(MODULE_GNRC_NETAPI_RING) || defined(DOXYGEN)
+        /**
+         * @brief   Target @ref gnrc_netapi_ring_t "packet ring" for the
+         *          registry entry
+         *
+         * @note    Only available with @ref net_gnrc_netapi_ring.
+         */
+        gnrc_netapi_ring_t *ring;
+#endif
     } target;                   /**< Target for the registry entry */
+
+    /**
+     * @brief   Number of packets that could not be delivered to the target,
+     *          e.g. because its message queue was full
+     */
+    uint32_t dropped;
 } gnrc_netreg_entry_t;
 
 /**
@@ -202,10 +263,12 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
 {
     entry->next = NULL;
     entry->demux_ctx = demux_ctx;
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_RING)
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
+    entry->dropped = 0;
 }
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -227,6 +290,7 @@ static inline void gnrc_netreg_entry_init_mbox(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_MBOX;
     entry->target.mbox = mbox;
+    entry->dropped = 0;
 }
 #endif
 
@@ -249,6 +313,31 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_CB;
     entry->target.cbd = cbd;
+    entry->dropped = 0;
+}
+#endif
+
+#if defined(MODULE_GNRC_NETAPI_RING) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry dynamically with packet ring
+ *
+ * @param[out] entry    A netreg entry
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] ring      Target @ref gnrc_netapi_ring_t "packet ring" for the
+ *                      registry entry
+ *
+ * @note    Only available with @ref net_gnrc_netapi_ring.
+ */
+static inline void gnrc_netreg_entry_init_ring(gnrc_netreg_entry_t *entry,
+                                               uint32_t demux_ctx,
+                                               gnrc_netapi_ring_t *ring)
+{
+    entry->next = NULL;
+    entry->demux_ctx = demux_ctx;
+    entry->type = GNRC_NETREG_TYPE_RING;
+    entry->target.ring = ring;
+    entry->dropped = 0;
 }
 #endif
 
@@ -307,6 +396,26 @@ gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
  */
 int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx);
 
+/**
+ * @brief   Searches for entries with given parameters in the registry,
+ *          returns the first found and counts all of them.
+ *
+ * This combines gnrc_netreg_lookup() and gnrc_netreg_num(), so a dispatcher
+ * only needs one search to know both where to start iterating with
+ * gnrc_netreg_getnext() and how often a packet needs to be held.
+ *
+ * @param[in] type      Type of the protocol.
+ * @param[in] demux_ctx The demultiplexing context for the registered thread.
+ *                      See gnrc_netreg_entry_t::demux_ctx.
+ * @param[out] num      Number of entries fitting the given parameters.
+ *                      Must not be NULL.
+ *
+ * @return  The first entry fitting the given parameters on success
+ * @return  NULL if no entry can be found.
+ */
+gnrc_netreg_entry_t *gnrc_netreg_lookup_num(gnrc_nettype_t type,
+                                            uint32_t demux_ctx, int *num);
+
 /**
  * @brief   Returns the next entry after @p entry with the same
  *          gnrc_netreg_entry_t::type and gnrc_netreg_entry_t::demux_ctx as the
@@ -115,6 +115,16 @@ typedef struct gnrc_pktsnip {
     kernel_pid_t err_sub;           /**< subscriber to errors related to this
                                      *   packet snip */
 #endif
+#if defined(MODULE_GNRC_UDP_CSUM_COPY) || defined(DOXYGEN)
+    /**
+     * @brief   Unnormalized Internet Checksum of gnrc_pktsnip_t::data, as
+     *          summed up while copying it into the packet buffer. 0 if unknown.
+     *
+     * @note    Only available with `gnrc_udp_csum_copy`. The packet buffer
+     *          resets it whenever it changes the data.
+     */
+    uint16_t csum;
+#endif
 } gnrc_pktsnip_t;
 
 /**
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_pktbuf_slab   Slab packet buffer
+ * @ingroup     net_gnrc_pktbuf
+ * @brief       Packet buffer implementation based on fixed size classes
+ *
+ * This is an alternative to `gnrc_pktbuf_static`. Select it by adding
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_pktbuf_slab
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * to your application's Makefile.
+ *
+ * Instead of one first-fit managed byte array the packet buffer consists of a
+ * pool of packet snip descriptors and three pools of equally sized data
+ * slots (small, medium and large). Every pool keeps its free slots in a
+ * singly linked list, so allocation and release are O(1) and the buffer can
+ * not fragment.
+ *
+ * Every data slot carries a reference counter of the snips pointing into it.
+ * This allows @ref gnrc_pktbuf_mark() to split a snip without copying any
+ * data: the marked snip and the remainder just share the slot, which is
+ * returned to its pool when the last of them is released.
+ *
+ * The price is internal fragmentation: a request is served by the smallest
+ * slot it fits in, and requests larger than @ref GNRC_PKTBUF_SLAB_LARGE_SIZE
+ * can not be served at all. Tune the size classes to your link layer.
+ * @ref GNRC_PKTBUF_SIZE is not used by this implementation.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Configuration of the slab packet buffer
+ */
+#ifndef GNRC_PKTBUF_SLAB_H_
+#define GNRC_PKTBUF_SLAB_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of packet snip descriptors
+ */
+#ifndef GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define GNRC_PKTBUF_SLAB_SNIP_NUMOF     (32)
+#endif
+
+/**
+ * @brief   Size of a slot in the small class in byte
+ *
+ * @details Intended for protocol headers (IPv6, UDP, netif header, ...)
+ */
+#ifndef GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define GNRC_PKTBUF_SLAB_SMALL_SIZE     (64)
+#endif
+
+/**
+ * @brief   Number of slots in the small class
+ */
+#ifndef GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define GNRC_PKTBUF_SLAB_SMALL_NUMOF    (16)
+#endif
+
+/**
+ * @brief   Size of a slot in the medium class in byte
+ *
+ * @details Intended for IEEE 802.15.4 frames and small payloads
+ */
+#ifndef GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define GNRC_PKTBUF_SLAB_MEDIUM_SIZE    (256)
+#endif
+
+/**
+ * @brief   Number of slots in the medium class
+ */
+#ifndef GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define GNRC_PKTBUF_SLAB_MEDIUM_NUMOF   (8)
+#endif
+
+/**
+ * @brief   Size of a slot in the large class in byte
+ *
+ * @details Must hold the largest packet any layer allocates in one piece,
+ *          i.e. a full Ethernet frame or a reassembled IPv6 datagram.
+ */
+#ifndef GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define GNRC_PKTBUF_SLAB_LARGE_SIZE     (1536)
+#endif
+
+/**
+ * @brief   Number of slots in the large class
+ */
+#ifndef GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define GNRC_PKTBUF_SLAB_LARGE_NUMOF    (2)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_PKTBUF_SLAB_H_ */
+/** @} */
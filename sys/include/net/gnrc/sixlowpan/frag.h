@@ -14,6 +14,19 @@
  * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
  *          RFC 4944, section 5.3
  *      </a>
+ *
+ * By default, a datagram is allocated in the packet buffer on arrival of its
+ * first fragment and every fragment is copied into it. With the
+ * `gnrc_sixlowpan_frag_chain` module, the received fragments are kept as they
+ * are instead and only copied into the datagram once all of them arrived, so
+ * incomplete datagrams only occupy the fragments received so far.
+ *
+ * Outgoing datagrams are fragmented one fragment at a time by default, with a
+ * message to the 6LoWPAN thread in between, and a datagram arriving meanwhile
+ * is dropped. With the `gnrc_sixlowpan_frag_pipeline` module, all fragments
+ * of a datagram are built and handed to the interface in one go instead. The
+ * payload is split up between the fragments rather than copied into them, if
+ * no one else holds a reference to it.
  * @{
  *
  * @file
@@ -11,6 +11,13 @@
  * @ingroup     net_gnrc
  * @brief       GNRC's implementation of the UDP protocol
  *
+ * With the (pseudo) module `gnrc_udp_csum_copy` @ref net_sock_udp sums up the
+ * checksum while copying the payload into or out of the packet buffer, so the
+ * payload is only touched once. On send, the payload's sum is kept in
+ * gnrc_pktsnip_t::csum for gnrc_udp_calc_csum(). On receive, the checksum of
+ * a packet is only verified by this module if not all of its receivers are
+ * socks, as sock_udp_recv() verifies it while copying.
+ *
  * @{
  *
  * @file
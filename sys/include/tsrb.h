@@ -19,6 +19,14 @@
  * This ringbuffer implementation can be used without locking if
  * there's only one producer and one consumer.
  *
+ * Besides copying bytes in and out with tsrb_add() and tsrb_get(), the
+ * producer can write bytes in place into the region returned by
+ * tsrb_add_region() and publish them with tsrb_add_commit(), and the consumer
+ * can peek at the region returned by tsrb_get_region() and release it with
+ * tsrb_get_commit(). This keeps the single producer and single consumer
+ * guarantees: a region is only handed to the other side when it is
+ * committed.
+ *
  * @note Buffer size must be a power of two!
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
@@ -128,6 +136,27 @@ int tsrb_get_one(tsrb_t *rb);
  */
 int tsrb_get(tsrb_t *rb, char *dst, size_t n);
 
+/**
+ * @brief       Peek the contiguous bytes available for reading
+ *
+ * Only to be called by the consumer. If the bytes wrap around the end of the
+ * buffer, only their first part is returned.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  region  start of the bytes available for reading
+ * @return      nr of bytes that can be read from @p region
+ */
+size_t tsrb_get_region(tsrb_t *rb, char **region);
+
+/**
+ * @brief       Release bytes read from a region
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes read from the region returned by
+ *                  tsrb_get_region(), must not exceed its size
+ */
+void tsrb_get_commit(tsrb_t *rb, size_t n);
+
 /**
  * @brief       Add a byte to ringbuffer
  * @param[in]   rb  Ringbuffer to operate on
@@ -146,6 +175,27 @@ int tsrb_add_one(tsrb_t *rb, char c);
  */
 int tsrb_add(tsrb_t *rb, const char *src, size_t n);
 
+/**
+ * @brief       Get the contiguous free space for writing
+ *
+ * Only to be called by the producer. If the free space wraps around the end
+ * of the buffer, only its first part is returned.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  region  start of the free space
+ * @return      nr of bytes that can be written to @p region
+ */
+size_t tsrb_add_region(tsrb_t *rb, char **region);
+
+/**
+ * @brief       Make bytes written to a region available for reading
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes written to the region returned by
+ *                  tsrb_add_region(), must not exceed its size
+ */
+void tsrb_add_commit(tsrb_t *rb, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -57,7 +57,7 @@ extern "C" {
  * @brief The container descriptor used to identify a universal address entry
  */
 typedef struct {
-    uint8_t use_count;                       /**< The number of entries link here */
+    uint16_t use_count;                      /**< The number of entries link here */
     uint8_t address_size;                    /**< Size in bytes of the used generic address */
     uint8_t address[UNIVERSAL_ADDRESS_SIZE]; /**< The generic address data */
 } universal_address_container_t;
@@ -76,17 +76,22 @@ void universal_address_reset(void);
  * @brief Add a given address to the universal address entries. If the entry already exists,
  *        the universal_address_container_t::use_count will be increased.
  *
+ * Existing entries are found through a hashed index, so the cost does not
+ * grow with the number of entries in the table.
+ *
  * @param[in] addr       pointer to the address
  * @param[in] addr_size  the number of bytes required for the address entry
  *
  * @return pointer to the universal_address_container_t containing the address on success
- * @return NULL if the address could not be inserted
+ * @return NULL if the address could not be inserted or is already referenced
+ *         UINT16_MAX times
  */
 universal_address_container_t *universal_address_add(uint8_t *addr, size_t addr_size);
 
 /**
  * @brief Add a given container from the universal address entries. If the entry exists,
  *        the universal_address_container_t::use_count will be decreased.
+ *        When it drops to 0 the container becomes free for other addresses.
  *
  * @param[in] entry  pointer to the universal_address_container_t to be removed
  */
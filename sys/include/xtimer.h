@@ -20,6 +20,17 @@
  * number of active timers.  The reason for this is that multiplexing is
  * realized by next-first singly linked lists.
  *
+ * With many pending timers, add the `xtimer_heap` module. It keeps all timers
+ * in a pairing heap instead, so inserting a timer takes O(1) and removing
+ * one, including the expired one in the ISR, takes amortized O(log n). Each
+ * timer grows by two pointers.
+ *
+ * Timers that do not need to be exact can be set with xtimer_set_slack().
+ * With the `xtimer_slack` module, timers are ordered by the latest time they
+ * may fire at, and every low-level timer interrupt fires all timers whose
+ * window has begun, so periodic work of independent modules shares wakeups.
+ * xtimer_wakeups() counts the low-level timer interrupts to measure this.
+ *
  * @{
  * @file
  * @brief   xtimer interface definitions
@@ -67,9 +78,17 @@ typedef void (*xtimer_callback_t)(void*);
  * @brief xtimer timer structure
  */
 typedef struct xtimer {
-    struct xtimer *next;        /**< reference to next timer in timer lists */
+    struct xtimer *next;        /**< reference to next timer in timer lists,
+                                     or next sibling in the timer heap */
+#if defined(MODULE_XTIMER_HEAP) || defined(DOXYGEN)
+    struct xtimer *child;       /**< first child in the timer heap */
+    struct xtimer *prev;        /**< parent or left sibling in the timer heap */
+#endif
     uint32_t target;            /**< lower 32bit absolute target time */
     uint32_t long_target;       /**< upper 32bit absolute target time */
+#if defined(MODULE_XTIMER_SLACK) || defined(DOXYGEN)
+    uint32_t slack;             /**< ticks the timer may fire before target */
+#endif
     xtimer_callback_t callback;  /**< callback function to call when timer
                                      expires */
     void *arg;                  /**< argument to pass to callback function */
@@ -290,6 +309,39 @@ static inline void xtimer_set_wakeup64(xtimer_t *timer, uint64_t offset, kernel_
  */
 static inline void xtimer_set(xtimer_t *timer, uint32_t offset);
 
+/**
+ * @brief Set a timer that may fire early by up to @p slack microseconds
+ *
+ * Works like xtimer_set(), but the callback is executed anywhere between
+ * @p offset and @p offset + @p slack microseconds in the future. Timers whose
+ * windows overlap are fired from a single low-level timer interrupt, which
+ * saves wakeups for periodic work that does not need to be exact.
+ *
+ * Without the `xtimer_slack` module @p slack is ignored and the callback is
+ * executed after @p offset microseconds.
+ *
+ * @param[in] timer     the timer structure to use.
+ *                      Its xtimer_t::target and xtimer_t::long_target
+ *                      fields need to be initialized with 0 on first use
+ * @param[in] offset    earliest time in microseconds from now to execute
+ *                      the timer's callback
+ * @param[in] slack     time in microseconds the execution may be delayed
+ *                      past @p offset
+ */
+static inline void xtimer_set_slack(xtimer_t *timer, uint32_t offset,
+                                    uint32_t slack);
+
+/**
+ * @brief Get the number of low-level timer interrupts handled so far
+ *
+ * Every interrupt wakes the CPU, so sampling this counter gives the
+ * wakeups per second caused by xtimer, including the ones needed to keep
+ * track of low-level timer overflows.
+ *
+ * @return  number of low-level timer interrupts since xtimer_init()
+ */
+uint32_t xtimer_wakeups(void);
+
 /**
  * @brief remove a timer
  *
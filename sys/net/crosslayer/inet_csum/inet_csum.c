@@ -14,16 +14,201 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
-uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
+/**
+ * @brief   A word of the buffer, which may alias its bytes
+ */
+typedef uint32_t __attribute__((__may_alias__)) _word_t;
+
+/**
+ * @brief   A half-word of the buffer, which may alias its bytes
+ */
+typedef uint16_t __attribute__((__may_alias__)) _half_t;
+
+static inline uint16_t _fold(uint64_t sum)
+{
+    uint32_t res;
+
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    res = (uint32_t)sum;
+    res = (res & 0xffff) + (res >> 16);
+    res = (res & 0xffff) + (res >> 16);
+
+    return res;
+}
+
+/**
+ * @brief   Places a single byte in the lower addressed byte of a half-word
+ */
+static inline uint16_t _first_byte(uint8_t byte)
 {
-    uint32_t csum = sum;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return byte;
+#else
+    return (uint16_t)(byte << 8);
+#endif
+}
 
+/**
+ * @brief   Sums @p buf in host byte order, starting at a half-word aligned
+ *          address
+ *
+ * The carries of the 32-bit words are kept in the upper half of the sum, so
+ * they only need to be folded in once at the end.
+ */
+static uint64_t _sum_aligned(const uint8_t *buf, size_t len)
+{
+    const _word_t *words;
+    uint64_t sum = 0;
+
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        sum += *(const _half_t *)buf;
+        buf += 2;
+        len -= 2;
+    }
+    words = (const _word_t *)buf;
+    for (; len >= 16; len -= 16, words += 4) {
+        sum += (uint64_t)words[0] + words[1] + words[2] + words[3];
+    }
+    for (; len >= 4; len -= 4, words++) {
+        sum += *words;
+    }
+    buf = (const uint8_t *)words;
+    if (len >= 2) {
+        sum += *(const _half_t *)buf;
+        buf += 2;
+        len -= 2;
+    }
+    if (len) {
+        sum += _first_byte(*buf);
+    }
+
+    return sum;
+}
+
+/**
+ * @brief   Sums @p buf in host byte order, with buf[0] as the lower addressed
+ *          byte of the first half-word
+ */
+static uint16_t _sum(const uint8_t *buf, size_t len)
+{
+    if ((uintptr_t)buf & 1) {
+        /* the aligned rest starts with the other byte of a half-word, which
+         * the one's complement sum allows to fix by swapping its bytes */
+        uint16_t rest = byteorder_swaps(_fold(_sum_aligned(buf + 1, len - 1)));
+
+        return _fold((uint64_t)rest + _first_byte(*buf));
+    }
+    return _fold(_sum_aligned(buf, len));
+}
+
+/**
+ * @brief   Copies and sums @p src in host byte order, with both starting at
+ *          the same half-word aligned offset within a word
+ */
+static uint64_t _copy_sum_aligned(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    const _word_t *words;
+    _word_t *dst_words;
+    uint64_t sum = 0;
+
+    if (((uintptr_t)src & 2) && (len >= 2)) {
+        sum += (*(_half_t *)dst = *(const _half_t *)src);
+        src += 2;
+        dst += 2;
+        len -= 2;
+    }
+    words = (const _word_t *)src;
+    dst_words = (_word_t *)dst;
+    for (; len >= 16; len -= 16, words += 4, dst_words += 4) {
+        uint32_t w0 = words[0], w1 = words[1], w2 = words[2], w3 = words[3];
+
+        dst_words[0] = w0;
+        dst_words[1] = w1;
+        dst_words[2] = w2;
+        dst_words[3] = w3;
+        sum += (uint64_t)w0 + w1 + w2 + w3;
+    }
+    for (; len >= 4; len -= 4, words++, dst_words++) {
+        sum += (*dst_words = *words);
+    }
+    src = (const uint8_t *)words;
+    dst = (uint8_t *)dst_words;
+    if (len >= 2) {
+        sum += (*(_half_t *)dst = *(const _half_t *)src);
+        src += 2;
+        dst += 2;
+        len -= 2;
+    }
+    if (len) {
+        *dst = *src;
+        sum += _first_byte(*src);
+    }
+
+    return sum;
+}
+
+/**
+ * @brief   Copies @p src to @p dst and sums it like _sum()
+ */
+static uint16_t _copy_sum(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    if (((uintptr_t)dst ^ (uintptr_t)src) & 3) {
+        /* the words of src and dst do not line up: copy in blocks and sum
+         * each block while it is still at hand */
+        uint64_t sum = 0;
+
+        while (len > 0) {
+            size_t block = (len < 64) ? len : 64;
+
+            memcpy(dst, src, block);
+            sum += _sum(dst, block);
+            dst += block;
+            src += block;
+            len -= block;
+        }
+        return _fold(sum);
+    }
+    if ((uintptr_t)src & 1) {
+        uint16_t rest;
+
+        *dst = *src;
+        rest = byteorder_swaps(_fold(_copy_sum_aligned(dst + 1, src + 1,
+                                                       len - 1)));
+        return _fold((uint64_t)rest + _first_byte(*src));
+    }
+    return _fold(_copy_sum_aligned(dst, src, len));
+}
+
+/**
+ * @brief   Adds the host byte order sum of a slice to @p sum
+ */
+static inline uint16_t _add_slice(uint16_t sum, uint16_t slice, size_t accum_len)
+{
+    /* buf[0] is the top half of a 16-bit word, unless the accumulated length
+     * is odd. The sum is in network byte order if the host agrees. */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (!(accum_len & 1)) {
+        slice = byteorder_swaps(slice);
+    }
+#else
+    if (accum_len & 1) {
+        slice = byteorder_swaps(slice);
+    }
+#endif
+    return _fold((uint64_t)sum + slice);
+}
+
+uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
+{
     DEBUG("inet_sum: sum = 0x%04" PRIx16 ", len = %" PRIu16, sum, len);
 #if ENABLE_DEBUG
 #ifdef MODULE_OD
@@ -35,31 +220,22 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
 #endif
 
     if (len == 0)
-        return csum;
+        return sum;
 
-    if (accum_len & 1) {      /* if accumulated length is odd */
-        csum += *buf;         /* add first byte as bottom half of 16-byte word */
-        buf++;
-        len--;
-        accum_len++;
-    }
+    sum = _add_slice(sum, _sum(buf, len), accum_len);
 
-    for (int i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    DEBUG("inet_sum: new sum = 0x%04" PRIx16 "\n", sum);
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
+    return sum;
+}
 
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
+uint16_t inet_csum_slice_copy(uint16_t sum, uint8_t *dst, const uint8_t *src,
+                              uint16_t len, size_t accum_len)
+{
+    if (len == 0) {
+        return sum;
     }
-
-    DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
-
-    return csum;
+    return _add_slice(sum, _copy_sum(dst, src, len), accum_len);
 }
 
 /** @} */
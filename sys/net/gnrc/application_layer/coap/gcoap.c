@@ -19,7 +19,11 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include "net/gnrc/coap.h"
+#include "byteorder.h"
+#include "hashes.h"
+#include "mutex.h"
 #include "random.h"
 #include "thread.h"
 
@@ -42,6 +46,15 @@ static size_t _send_buf( uint8_t *buf, size_t len, ipv6_addr_t *src, uint16_t po
 static void _expire_request(gcoap_request_memo_t *memo);
 static void _find_req_memo(gcoap_request_memo_t **memo_ptr, coap_pkt_t *pdu,
                                                             uint8_t *buf, size_t len);
+#ifdef MODULE_GCOAP_CON
+static void _handle_empty(coap_pkt_t *pdu);
+#endif
+static gcoap_request_memo_t *_alloc_memo(void);
+static void _free_memo(gcoap_request_memo_t *memo);
+static coap_resource_t *_find_resource(coap_pkt_t *pdu, unsigned method_flag);
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+static void _index_listener(gcoap_listener_t *listener);
+#endif
 
 /* Internal variables */
 const coap_resource_t _default_resources[] = {
@@ -62,6 +75,46 @@ static gcoap_state_t _coap_state = {
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _msg_stack[GCOAP_STACK_SIZE];
 
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+#if (GCOAP_RESOURCE_INDEX_SIZE & (GCOAP_RESOURCE_INDEX_SIZE - 1)) != 0
+#error "GCOAP_RESOURCE_INDEX_SIZE must be a power of two"
+#endif
+/* Resources of all listeners by hashed path, with linear probing. Resources
+ * with the same path are kept in the order they were registered. */
+static coap_resource_t *_index[GCOAP_RESOURCE_INDEX_SIZE];
+static unsigned _index_used;
+/* Set if a resource did not fit into _index */
+static bool _index_full;
+#endif
+
+/* Protects the open requests, which are also allocated by application
+ * threads in gcoap_req_send(). Never held while calling a response handler. */
+static mutex_t _req_lock = MUTEX_INIT;
+
+#if GCOAP_REQ_WAITING_MAX > 255
+#error "GCOAP_REQ_WAITING_MAX must not exceed the uint8_t count of gcoap_op_state()"
+#endif
+
+#ifdef MODULE_GCOAP_REQ_INDEX
+#if (GCOAP_REQ_INDEX_SIZE & (GCOAP_REQ_INDEX_SIZE - 1)) != 0
+#error "GCOAP_REQ_INDEX_SIZE must be a power of two"
+#endif
+/* Open requests by hashed token, chained by their next pointer */
+static gcoap_request_memo_t *_req_index[GCOAP_REQ_INDEX_SIZE];
+/* Unused memos, chained by their next pointer */
+static gcoap_request_memo_t *_req_free;
+#ifdef MODULE_GCOAP_CON
+/* Confirmable requests awaiting an ACK by message ID, chained by their
+ * con_next pointer */
+static gcoap_request_memo_t *_con_index[GCOAP_REQ_INDEX_SIZE];
+#endif
+#endif
+
+/* Message type of a CoAP header, a COAP_TYPE... */
+static inline unsigned _get_type(coap_hdr_t *hdr)
+{
+    return (hdr->ver_t_tkl & 0x30) >> 4;
+}
 
 /* Event/Message loop for gcoap _pid thread. */
 static void *_event_loop(void *arg)
@@ -135,8 +188,14 @@ static void _receive(gnrc_pktsnip_t *pkt, ipv6_addr_t *src, uint16_t port)
         goto exit;
     }
 
+    /* empty message, i.e. an ACK or RST for a confirmable request */
+    if (pdu.hdr->code == 0) {
+#ifdef MODULE_GCOAP_CON
+        _handle_empty(&pdu);
+#endif
+    }
     /* incoming request */
-    if (coap_get_code_class(&pdu) == COAP_CLASS_REQ) {
+    else if (coap_get_code_class(&pdu) == COAP_CLASS_REQ) {
         if (pkt->size > sizeof(buf)) {
             DEBUG("gcoap: request too big: %u\n", pkt->size);
             pdu_len = gcoap_response(&pdu, buf, sizeof(buf),
@@ -150,15 +209,31 @@ static void _receive(gnrc_pktsnip_t *pkt, ipv6_addr_t *src, uint16_t port)
     }
     /* incoming response */
     else {
+        if (_get_type(pdu.hdr) == COAP_TYPE_CON) {
+            /* acknowledge a separate response */
+            coap_hdr_t ack;
+            coap_build_hdr(&ack, COAP_TYPE_ACK, NULL, 0, 0, 0);
+            ack.id = pdu.hdr->id;
+            _send_buf((uint8_t *)&ack, sizeof(ack), src, port);
+        }
+
+        mutex_lock(&_req_lock);
         _find_req_memo(&memo, &pdu, buf, sizeof(buf));
         if (memo) {
             xtimer_remove(&memo->response_timer);
+        }
+        mutex_unlock(&_req_lock);
+
+        if (memo) {
             if (pkt->size > sizeof(buf)) {
                 memo->state = GCOAP_MEMO_ERR;
                 DEBUG("gcoap: response too big: %u\n", pkt->size);
             }
             memo->resp_handler(memo->state, &pdu);
-            memo->state = GCOAP_MEMO_UNUSED;
+
+            mutex_lock(&_req_lock);
+            _free_memo(memo);
+            mutex_unlock(&_req_lock);
         }
     }
 
@@ -176,6 +251,72 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len)
     unsigned method_flag = coap_method2flag(coap_get_code_detail(pdu));
 
     /* Find path for CoAP msg among listener resources and execute callback. */
+    coap_resource_t *resource = _find_resource(pdu, method_flag);
+    if (resource) {
+        ssize_t pdu_len = resource->handler(pdu, buf, len);
+        if (pdu_len < 0) {
+            pdu_len = gcoap_response(pdu, buf, len,
+                                     COAP_CODE_INTERNAL_SERVER_ERROR);
+        }
+        return pdu_len;
+    }
+    /* resource not found */
+    return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
+}
+
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+static unsigned _index_slot(const char *path)
+{
+    return djb2_hash((const uint8_t *)path, strlen(path)) &
+           (GCOAP_RESOURCE_INDEX_SIZE - 1);
+}
+
+/*
+ * Adds the resources of a listener to the index. Leaves at least one slot
+ * empty, so a lookup always terminates.
+ */
+static void _index_listener(gcoap_listener_t *listener)
+{
+    for (size_t i = 0; i < listener->resources_len; i++) {
+        if (_index_used >= (GCOAP_RESOURCE_INDEX_SIZE - 1)) {
+            DEBUG("gcoap: resource index full with %u resources, falling back "
+                  "to linear lookup; raise GCOAP_RESOURCES_MAX\n",
+                  _index_used);
+            _index_full = true;
+            return;
+        }
+        unsigned slot = _index_slot(listener->resources[i].path);
+        while (_index[slot]) {
+            slot = (slot + 1) & (GCOAP_RESOURCE_INDEX_SIZE - 1);
+        }
+        _index[slot] = &listener->resources[i];
+        _index_used++;
+    }
+}
+#endif
+
+/*
+ * Finds the first registered resource for the request's path that accepts
+ * the request's method.
+ *
+ * Returns NULL if there is none.
+ */
+static coap_resource_t *_find_resource(coap_pkt_t *pdu, unsigned method_flag)
+{
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+    if (!_index_full) {
+        unsigned slot = _index_slot((char *)&pdu->url[0]);
+        while (_index[slot]) {
+            coap_resource_t *resource = _index[slot];
+            if ((resource->methods & method_flag) &&
+                (strcmp((char *)&pdu->url[0], resource->path) == 0)) {
+                return resource;
+            }
+            slot = (slot + 1) & (GCOAP_RESOURCE_INDEX_SIZE - 1);
+        }
+        return NULL;
+    }
+#endif
     gcoap_listener_t *listener = _coap_state.listeners;
     while (listener) {
         coap_resource_t *resource = listener->resources;
@@ -196,18 +337,12 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len)
                 break;
             }
             else {
-                ssize_t pdu_len = resource->handler(pdu, buf, len);
-                if (pdu_len < 0) {
-                    pdu_len = gcoap_response(pdu, buf, len,
-                                             COAP_CODE_INTERNAL_SERVER_ERROR);
-                }
-                return pdu_len;
+                return resource;
             }
         }
         listener = listener->next;
     }
-    /* resource not found */
-    return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
+    return NULL;
 }
 
 /*
@@ -233,67 +368,263 @@ static ssize_t _finish_pdu(coap_pkt_t *pdu, uint8_t *buf, size_t len)
     }
 }
 
+/* Tests if the token of a request memo matches the token of src_pdu. */
+static bool _token_match(gcoap_request_memo_t *memo, coap_pkt_t *src_pdu)
+{
+    coap_pkt_t memo_pdu = { .token = NULL };
+
+    /* setup memo PDU from memo header */
+    coap_hdr_t *memo_hdr = (coap_hdr_t *) &memo->hdr_buf[0];
+    memo_pdu.hdr         = memo_hdr;
+    if (coap_get_token_len(&memo_pdu)) {
+        memo_pdu.token = &memo_hdr->data[0];
+    }
+    /* match on token */
+    if (coap_get_token_len(src_pdu) == coap_get_token_len(&memo_pdu)) {
+        uint8_t *src_byte  = src_pdu->token;
+        uint8_t *memo_byte = memo_pdu.token;
+        size_t j;
+        for (j = 0; j < coap_get_token_len(src_pdu); j++) {
+            if (*src_byte++ != *memo_byte++) {
+                return false;   /* token mismatch */
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+#ifdef MODULE_GCOAP_REQ_INDEX
+/* Index bucket for the token of a request or response header */
+static unsigned _req_slot(coap_hdr_t *hdr)
+{
+    coap_pkt_t pdu = { .hdr = hdr };
+
+    return djb2_hash(&hdr->data[0], coap_get_token_len(&pdu)) &
+           (GCOAP_REQ_INDEX_SIZE - 1);
+}
+
+#ifdef MODULE_GCOAP_CON
+/* Bucket in _con_index for the message ID of a request or empty message */
+static unsigned _con_slot(coap_hdr_t *hdr)
+{
+    /* message IDs are sequential, so their low bits spread well */
+    return NTOHS(hdr->id) & (GCOAP_REQ_INDEX_SIZE - 1);
+}
+#endif
+#endif
+
+#ifdef MODULE_GCOAP_CON
+/*
+ * Stops keeping a confirmable request for retransmission.
+ *
+ * Expects _req_lock to be held.
+ */
+static void _release_resend(gcoap_request_memo_t *memo)
+{
+    if (!memo->resend_pkt) {
+        return;
+    }
+#ifdef MODULE_GCOAP_REQ_INDEX
+    gcoap_request_memo_t **prev =
+                    &_con_index[_con_slot((coap_hdr_t *)&memo->hdr_buf[0])];
+    while (*prev != memo) {
+        prev = &(*prev)->con_next;
+    }
+    *prev = memo->con_next;
+#endif
+    gnrc_pktbuf_release(memo->resend_pkt);
+    memo->resend_pkt = NULL;
+}
+#endif
+
+/*
+ * Takes an unused memo from _coap_state.open_reqs and sets it waiting.
+ *
+ * Expects _req_lock to be held. Returns NULL if all memos are in use.
+ */
+static gcoap_request_memo_t *_alloc_memo(void)
+{
+    gcoap_request_memo_t *memo = NULL;
+
+#ifdef MODULE_GCOAP_REQ_INDEX
+    memo = _req_free;
+    if (memo) {
+        _req_free = memo->next;
+    }
+#else
+    for (int i = 0; i < GCOAP_REQ_WAITING_MAX; i++) {
+        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
+            memo = &_coap_state.open_reqs[i];
+            break;
+        }
+    }
+#endif
+    if (memo) {
+        memo->state = GCOAP_MEMO_WAIT;
+    }
+    return memo;
+}
+
+/*
+ * Releases the request kept for retransmission, if any, and returns a memo
+ * to the unused ones.
+ *
+ * Expects _req_lock to be held.
+ */
+static void _free_memo(gcoap_request_memo_t *memo)
+{
+#ifdef MODULE_GCOAP_CON
+    _release_resend(memo);
+#endif
+#ifdef MODULE_GCOAP_REQ_INDEX
+    gcoap_request_memo_t **prev =
+                    &_req_index[_req_slot((coap_hdr_t *)&memo->hdr_buf[0])];
+    while (*prev != memo) {
+        prev = &(*prev)->next;
+    }
+    *prev      = memo->next;
+    memo->next = _req_free;
+    _req_free  = memo;
+#endif
+    memo->state = GCOAP_MEMO_UNUSED;
+}
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on token.
  *
+ * Expects _req_lock to be held.
+ *
  * src_pdu Source for the match token
  */
 static void _find_req_memo(gcoap_request_memo_t **memo_ptr, coap_pkt_t *src_pdu,
                                                             uint8_t *buf, size_t len)
 {
     gcoap_request_memo_t *memo;
-    coap_pkt_t memo_pdu = { .token = NULL };
     (void) buf;
     (void) len;
 
+#ifdef MODULE_GCOAP_REQ_INDEX
+    for (memo = _req_index[_req_slot(src_pdu->hdr)]; memo; memo = memo->next) {
+        if (_token_match(memo, src_pdu)) {
+            *memo_ptr = memo;
+            return;
+        }
+    }
+#else
     for (int i = 0; i < GCOAP_REQ_WAITING_MAX; i++) {
         if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED)
             continue;
 
-        /* setup memo PDU from memo header */
-        memo                 = &_coap_state.open_reqs[i];
-        coap_hdr_t *memo_hdr = (coap_hdr_t *) &memo->hdr_buf[0];
-        memo_pdu.hdr         = memo_hdr;
-        if (coap_get_token_len(&memo_pdu)) {
-            memo_pdu.token = &memo_hdr->data[0];
+        memo = &_coap_state.open_reqs[i];
+        if (_token_match(memo, src_pdu)) {
+            *memo_ptr = memo;
         }
-        /* match on token */
-        if (coap_get_token_len(src_pdu) == coap_get_token_len(&memo_pdu)) {
-            uint8_t *src_byte  = src_pdu->token;
-            uint8_t *memo_byte = memo_pdu.token;
-            size_t j;
-            for (j = 0; j < coap_get_token_len(src_pdu); j++) {
-                if (*src_byte++ != *memo_byte++) {
-                    break;      /* token mismatch */
-                }
-            }
-            if (j == coap_get_token_len(src_pdu)) {
-                *memo_ptr = memo;
-            }
+    }
+#endif
+}
+
+#ifdef MODULE_GCOAP_CON
+/*
+ * Handles an empty ACK or RST for a confirmable request. Matches on message ID.
+ *
+ * An ACK stops retransmission; the response follows separately. A RST ends the
+ * request with GCOAP_MEMO_ERR.
+ */
+static void _handle_empty(coap_pkt_t *pdu)
+{
+    gcoap_request_memo_t *memo = NULL;
+    unsigned type = _get_type(pdu->hdr);
+    coap_pkt_t req;
+
+    if ((type != COAP_TYPE_ACK) && (type != COAP_TYPE_RST)) {
+        return;
+    }
+
+    mutex_lock(&_req_lock);
+#ifdef MODULE_GCOAP_REQ_INDEX
+    for (gcoap_request_memo_t *open_req = _con_index[_con_slot(pdu->hdr)];
+         open_req; open_req = open_req->con_next) {
+#else
+    for (int i = 0; i < GCOAP_REQ_WAITING_MAX; i++) {
+        gcoap_request_memo_t *open_req = &_coap_state.open_reqs[i];
+#endif
+        if ((open_req->state == GCOAP_MEMO_WAIT) && open_req->resend_pkt &&
+            (((coap_hdr_t *)&open_req->hdr_buf[0])->id == pdu->hdr->id)) {
+            memo = open_req;
+            break;
+        }
+    }
+    if (!memo) {
+        mutex_unlock(&_req_lock);
+        return;
+    }
+    xtimer_remove(&memo->response_timer);
+    if (type == COAP_TYPE_ACK) {
+        DEBUG("gcoap: request acknowledged; awaiting separate response\n");
+        _release_resend(memo);
+        if (GCOAP_NON_TIMEOUT > 0) {
+            xtimer_set_msg(&memo->response_timer, GCOAP_NON_TIMEOUT,
+                                                  &memo->timeout_msg, _pid);
         }
+        mutex_unlock(&_req_lock);
+        return;
     }
+    memo->state = GCOAP_MEMO_ERR;
+    mutex_unlock(&_req_lock);
+
+    req.hdr = (coap_hdr_t *)&memo->hdr_buf[0];   /* for reference */
+    memo->resp_handler(memo->state, &req);
+
+    mutex_lock(&_req_lock);
+    _free_memo(memo);
+    mutex_unlock(&_req_lock);
 }
+#endif
 
-/* Calls handler callback on receipt of a timeout message. */
+/*
+ * With gcoap_con, retransmits a confirmable request on receipt of a timeout
+ * message, with twice the previous timeout. Calls handler callback when out of
+ * retransmissions, or for a non-confirmable request.
+ */
 static void _expire_request(gcoap_request_memo_t *memo)
 {
     coap_pkt_t req;
 
     DEBUG("coap: received timeout message\n");
-    if (memo->state == GCOAP_MEMO_WAIT) {
-        memo->state = GCOAP_MEMO_TIMEOUT;
-        /* Pass response to handler */
-        if (memo->resp_handler) {
-            req.hdr = (coap_hdr_t *)&memo->hdr_buf[0];   /* for reference */
-            memo->resp_handler(memo->state, &req);
-        }
-        memo->state = GCOAP_MEMO_UNUSED;
-    }
-    else {
+    mutex_lock(&_req_lock);
+    if (memo->state != GCOAP_MEMO_WAIT) {
         /* Response already handled; timeout must have fired while response */
         /* was in queue. */
+        mutex_unlock(&_req_lock);
+        return;
     }
+#ifdef MODULE_GCOAP_CON
+    if (memo->resend_pkt && memo->send_limit) {
+        DEBUG("gcoap: retransmitting request\n");
+        memo->send_limit--;
+        memo->resend_timeout *= 2;
+        gnrc_pktbuf_hold(memo->resend_pkt, 1);
+        _send(memo->resend_pkt, &memo->remote_addr, memo->remote_port);
+        xtimer_set_msg(&memo->response_timer, memo->resend_timeout,
+                                              &memo->timeout_msg, _pid);
+        mutex_unlock(&_req_lock);
+        return;
+    }
+#endif
+    memo->state = GCOAP_MEMO_TIMEOUT;
+    mutex_unlock(&_req_lock);
+
+    /* Pass response to handler */
+    if (memo->resp_handler) {
+        req.hdr = (coap_hdr_t *)&memo->hdr_buf[0];   /* for reference */
+        memo->resp_handler(memo->state, &req);
+    }
+
+    mutex_lock(&_req_lock);
+    _free_memo(memo);
+    mutex_unlock(&_req_lock);
 }
 
 /* Registers receive/send port with GNRC registry. */
@@ -462,8 +793,17 @@ kernel_pid_t gcoap_init(void)
     }
     /* Blank list of open requests so we know if an entry is available. */
     memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
+#ifdef MODULE_GCOAP_REQ_INDEX
+    for (int i = GCOAP_REQ_WAITING_MAX - 1; i >= 0; i--) {
+        _coap_state.open_reqs[i].next = _req_free;
+        _req_free = &_coap_state.open_reqs[i];
+    }
+#endif
     /* randomize initial value */
     _coap_state.last_message_id = random_uint32() & 0xFFFF;
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+    _index_listener(&_default_listener);
+#endif
 
     return _pid;
 }
@@ -477,6 +817,9 @@ void gcoap_register_listener(gcoap_listener_t *listener)
 
     listener->next = NULL;
     _last->next = listener;
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+    _index_listener(listener);
+#endif
 }
 
 int gcoap_req_init(coap_pkt_t *pdu, uint8_t *buf, size_t len, unsigned code,
@@ -531,41 +874,77 @@ size_t gcoap_req_send(uint8_t *buf, size_t len, ipv6_addr_t *addr, uint16_t port
                                                  gcoap_resp_handler_t resp_handler)
 {
     gcoap_request_memo_t *memo = NULL;
+    gnrc_pktsnip_t *snip;
+    uint32_t timeout = GCOAP_NON_TIMEOUT;
     assert(resp_handler != NULL);
 
-    /* Find empty slot in list of open requests. */
-    for (int i = 0; i < GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
-            memo = &_coap_state.open_reqs[i];
-            memo->state = GCOAP_MEMO_WAIT;
-            break;
-        }
+    snip = gnrc_pktbuf_add(NULL, buf, len, GNRC_NETTYPE_UNDEF);
+    if (!snip) {
+        return 0;
     }
-    if (memo) {
-        memcpy(&memo->hdr_buf[0], buf, GCOAP_HEADER_MAXLEN);
-        memo->resp_handler = resp_handler;
-
-        size_t res = _send_buf(buf, len, addr, port);
-        if (res && (GCOAP_NON_TIMEOUT > 0)) {
-            /* start response wait timer */
-            memo->timeout_msg.type        = GCOAP_NETAPI_MSG_TYPE_TIMEOUT;
-            memo->timeout_msg.content.ptr = (char *)memo;
-            xtimer_set_msg(&memo->response_timer, GCOAP_NON_TIMEOUT,
-                                                  &memo->timeout_msg, _pid);
-        }
-        else if (!res) {
-            memo->state = GCOAP_MEMO_UNUSED;
-        }
-        return res;
-    } else {
+
+    /* Find empty slot in list of open requests. */
+    mutex_lock(&_req_lock);
+    memo = _alloc_memo();
+    if (!memo) {
+        mutex_unlock(&_req_lock);
         DEBUG("gcoap: dropping request; no space for response tracking\n");
+        gnrc_pktbuf_release(snip);
         return 0;
     }
+    memcpy(&memo->hdr_buf[0], buf, GCOAP_HEADER_MAXLEN);
+    memo->resp_handler = resp_handler;
+#ifdef MODULE_GCOAP_CON
+    memo->remote_addr  = *addr;
+    memo->remote_port  = port;
+    if (_get_type((coap_hdr_t *)buf) == COAP_TYPE_CON) {
+        /* keep the request for retransmission */
+        gnrc_pktbuf_hold(snip, 1);
+        memo->resend_pkt     = snip;
+        memo->send_limit     = GCOAP_MAX_RETRANSMIT;
+        memo->resend_timeout = GCOAP_ACK_TIMEOUT +
+                               random_uint32_range(0, GCOAP_ACK_TIMEOUT_RANDOM + 1);
+        timeout = memo->resend_timeout;
+#ifdef MODULE_GCOAP_REQ_INDEX
+        unsigned con_slot = _con_slot((coap_hdr_t *)&memo->hdr_buf[0]);
+        memo->con_next       = _con_index[con_slot];
+        _con_index[con_slot] = memo;
+#endif
+    }
+#endif
+#ifdef MODULE_GCOAP_REQ_INDEX
+    unsigned slot = _req_slot((coap_hdr_t *)&memo->hdr_buf[0]);
+    memo->next       = _req_index[slot];
+    _req_index[slot] = memo;
+#endif
+    /* start response wait timer before sending, as the response may be
+     * handled before _send() returns */
+    if (timeout > 0) {
+        memo->timeout_msg.type        = GCOAP_NETAPI_MSG_TYPE_TIMEOUT;
+        memo->timeout_msg.content.ptr = (char *)memo;
+        xtimer_set_msg(&memo->response_timer, timeout, &memo->timeout_msg, _pid);
+    }
+    mutex_unlock(&_req_lock);
+
+    size_t res = _send(snip, addr, port);
+    if (!res) {
+        mutex_lock(&_req_lock);
+        if (memo->state == GCOAP_MEMO_WAIT) {
+            xtimer_remove(&memo->response_timer);
+            _free_memo(memo);
+        }
+        mutex_unlock(&_req_lock);
+    }
+    return res;
 }
 
 int gcoap_resp_init(coap_pkt_t *pdu, uint8_t *buf, size_t len, unsigned code)
 {
-    /* Assume NON type request, so response type is the same. */
+    /* Piggyback the response on the ACK for a CON request; otherwise the
+     * response type is the same as for the request. */
+    if (_get_type(pdu->hdr) == COAP_TYPE_CON) {
+        gcoap_hdr_set_type(pdu->hdr, COAP_TYPE_ACK);
+    }
     coap_hdr_set_code(pdu->hdr, code);
     /* Create message ID since NON? */
 
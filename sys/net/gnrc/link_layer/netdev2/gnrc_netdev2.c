@@ -38,6 +38,7 @@
 #endif
 
 #define NETDEV2_NETAPI_MSG_QUEUE_SIZE 8
+#define NETDEV2_NETAPI_MSG_BULK_SIZE 4
 
 static void _pass_on_packet(gnrc_pktsnip_t *pkt);
 
@@ -114,8 +115,11 @@ static void *_gnrc_netdev2_thread(void *args)
     gnrc_netdev2->pid = thread_getpid();
 
     gnrc_netapi_opt_t *opt;
+    gnrc_netapi_opts_t *opts;
     int res;
     msg_t msg, reply, msg_queue[NETDEV2_NETAPI_MSG_QUEUE_SIZE];
+    msg_t msg_bulk[NETDEV2_NETAPI_MSG_BULK_SIZE];
+    unsigned msg_num = 0, msg_idx = 0;
 
     /* setup the MAC layers message queue */
     msg_init_queue(msg_queue, NETDEV2_NETAPI_MSG_QUEUE_SIZE);
@@ -132,8 +136,12 @@ static void *_gnrc_netdev2_thread(void *args)
 
     /* start the event loop */
     while (1) {
-        DEBUG("gnrc_netdev2: waiting for incoming messages\n");
-        msg_receive(&msg);
+        if (msg_idx == msg_num) {
+            DEBUG("gnrc_netdev2: waiting for incoming messages\n");
+            msg_num = msg_receive_bulk(msg_bulk, NETDEV2_NETAPI_MSG_BULK_SIZE);
+            msg_idx = 0;
+        }
+        msg = msg_bulk[msg_idx++];
         /* dispatch NETDEV and NETAPI messages */
         switch (msg.type) {
             case NETDEV2_MSG_TYPE_EVENT:
@@ -171,6 +179,30 @@ static void *_gnrc_netdev2_thread(void *args)
                 reply.content.value = (uint32_t)res;
                 msg_reply(&msg, &reply);
                 break;
+            case GNRC_NETAPI_MSG_TYPE_OPTS:
+                /* read incoming option requests */
+                opts = msg.content.ptr;
+                DEBUG("gnrc_netdev2: GNRC_NETAPI_MSG_TYPE_OPTS received. numof=%u\n",
+                        opts->numof);
+                for (unsigned i = 0; i < opts->numof; i++) {
+                    gnrc_netapi_opt_req_t *req = &opts->reqs[i];
+
+                    if (req->type == GNRC_NETAPI_MSG_TYPE_SET) {
+                        req->res = dev->driver->set(dev, req->opt.opt,
+                                                    req->opt.data,
+                                                    req->opt.data_len);
+                    }
+                    else {
+                        req->res = dev->driver->get(dev, req->opt.opt,
+                                                    req->opt.data,
+                                                    req->opt.data_len);
+                    }
+                }
+                /* send reply to calling thread */
+                reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
+                reply.content.value = (uint32_t)opts->numof;
+                msg_reply(&msg, &reply);
+                break;
             default:
                 DEBUG("gnrc_netdev2: Unknown command %" PRIu16 "\n", msg.type);
                 break;
@@ -65,6 +65,7 @@ static void *_nomac_thread(void *args)
 {
     gnrc_netdev_t *dev = (gnrc_netdev_t *)args;
     gnrc_netapi_opt_t *opt;
+    gnrc_netapi_opts_t *opts;
     int res;
     msg_t msg, reply, msg_queue[GNRC_NOMAC_MSG_QUEUE_SIZE];
 
@@ -118,6 +119,29 @@ static void *_nomac_thread(void *args)
                 reply.content.value = (uint32_t)res;
                 msg_reply(&msg, &reply);
                 break;
+            case GNRC_NETAPI_MSG_TYPE_OPTS:
+                DEBUG("nomac: GNRC_NETAPI_MSG_TYPE_OPTS received\n");
+                /* read incoming option requests */
+                opts = msg.content.ptr;
+                for (unsigned i = 0; i < opts->numof; i++) {
+                    gnrc_netapi_opt_req_t *req = &opts->reqs[i];
+
+                    if (req->type == GNRC_NETAPI_MSG_TYPE_SET) {
+                        req->res = dev->driver->set(dev, req->opt.opt,
+                                                    req->opt.data,
+                                                    req->opt.data_len);
+                    }
+                    else {
+                        req->res = dev->driver->get(dev, req->opt.opt,
+                                                    req->opt.data,
+                                                    req->opt.data_len);
+                    }
+                }
+                /* send reply to calling thread */
+                reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
+                reply.content.value = (uint32_t)opts->numof;
+                msg_reply(&msg, &reply);
+                break;
             default:
                 DEBUG("nomac: Unknown command %" PRIu16 "\n", msg.type);
                 break;
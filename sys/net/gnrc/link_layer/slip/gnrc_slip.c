@@ -235,6 +235,22 @@ static void *_slip(void *args)
                 DEBUG("slip: I don't support this but have to reply.\n");
                 msg_reply(&msg, &reply);
                 break;
+
+            case GNRC_NETAPI_MSG_TYPE_OPTS: {
+                gnrc_netapi_opts_t *opts = msg.content.ptr;
+
+                DEBUG("slip: GNRC_NETAPI_MSG_TYPE_OPTS received\n");
+                for (unsigned i = 0; i < opts->numof; i++) {
+                    gnrc_netapi_opt_req_t *req = &opts->reqs[i];
+
+                    req->res = (req->type == GNRC_NETAPI_MSG_TYPE_GET) ?
+                               _slip_get(&req->opt) : -ENOTSUP;
+                }
+                reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
+                reply.content.value = (uint32_t)opts->numof;
+                msg_reply(&msg, &reply);
+                break;
+            }
         }
     }
 
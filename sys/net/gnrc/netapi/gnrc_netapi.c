@@ -18,6 +18,9 @@
  * @}
  */
 
+#include <assert.h>
+
+#include "irq.h"
 #include "mbox.h"
 #include "msg.h"
 #include "net/gnrc/netreg.h"
@@ -91,18 +94,75 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+#ifdef MODULE_GNRC_NETAPI_RING
+static inline int _snd_rcv_ring(gnrc_netapi_ring_t *ring, uint16_t type,
+                                gnrc_pktsnip_t *pkt)
+{
+    /* several threads may dispatch into the same ring, so the producers are
+     * serialized while the consumer side stays lock-free */
+    unsigned state = irq_disable();
+    unsigned writes = ring->writes;
+
+    if ((writes - ring->reads) >= ring->size) {
+        irq_restore(state);
+        DEBUG("gnrc_netapi: dropped message to %p (was full)\n", (void *)ring);
+        return 0;
+    }
+    volatile msg_t *slot = &ring->buf[writes & (ring->size - 1)];
+    slot->sender_pid = sched_active_pid;
+    slot->type = type;
+    slot->content.ptr = (void *)pkt;
+    ring->writes = writes + 1;
+    irq_restore(state);
+
+    /* only causes a context switch if the consumer waits for the flag */
+    thread_flags_set(ring->thread, ring->flag);
+    return 1;
+}
+
+void gnrc_netapi_ring_init(gnrc_netapi_ring_t *ring, msg_t *buf,
+                           unsigned size, thread_flags_t flag)
+{
+    assert((size != 0) && ((size & (size - 1)) == 0));
+
+    ring->buf = buf;
+    ring->size = size;
+    ring->reads = 0;
+    ring->writes = 0;
+    ring->thread = (thread_t *)sched_active_thread;
+    ring->flag = flag;
+}
+
+int gnrc_netapi_ring_get(gnrc_netapi_ring_t *ring, msg_t *msg)
+{
+    unsigned reads = ring->reads;
+
+    assert(ring->thread == sched_active_thread);
+    if (reads == ring->writes) {
+        return 0;
+    }
+    volatile msg_t *slot = &ring->buf[reads & (ring->size - 1)];
+    msg->sender_pid = slot->sender_pid;
+    msg->type = slot->type;
+    msg->content.ptr = slot->content.ptr;
+    /* publish the free slot only after it was read */
+    ring->reads = reads + 1;
+    return 1;
+}
+#endif
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
-    int numof = gnrc_netreg_num(type, demux_ctx);
+    int numof;
+    gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup_num(type, demux_ctx, &numof);
 
     if (numof != 0) {
-        gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
-
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_RING)
             int release = 0;
             switch (sendto->type) {
                 case GNRC_NETREG_TYPE_DEFAULT:
@@ -123,6 +183,14 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                 case GNRC_NETREG_TYPE_CB:
                     sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
                     break;
+#endif
+#ifdef MODULE_GNRC_NETAPI_RING
+                case GNRC_NETREG_TYPE_RING:
+                    if (_snd_rcv_ring(sendto->target.ring, cmd, pkt) < 1) {
+                        /* unable to dispatch packet */
+                        release = 1;
+                    }
+                    break;
 #endif
                 default:
                     /* unknown dispatch type */
@@ -130,11 +198,13 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                     break;
             }
             if (release) {
+                sendto->dropped++;
                 gnrc_pktbuf_release(pkt);
             }
 #else
             if (_snd_rcv(sendto->target.pid, cmd, pkt) < 1) {
                 /* unable to dispatch packet */
+                sendto->dropped++;
                 gnrc_pktbuf_release(pkt);
             }
 #endif
@@ -168,3 +238,20 @@ int gnrc_netapi_set(kernel_pid_t pid, netopt_t opt, uint16_t context,
     return _get_set(pid, GNRC_NETAPI_MSG_TYPE_SET, opt, context,
                     data, data_len);
 }
+
+int gnrc_netapi_opts(kernel_pid_t pid, gnrc_netapi_opt_req_t *reqs,
+                     unsigned numof)
+{
+    msg_t cmd;
+    msg_t ack;
+    gnrc_netapi_opts_t opts = { .reqs = reqs, .numof = numof };
+
+    if (numof == 0) {
+        return 0;
+    }
+    cmd.type = GNRC_NETAPI_MSG_TYPE_OPTS;
+    cmd.content.ptr = (void *)&opts;
+    msg_send_receive(&cmd, &ack, pid);
+    assert(ack.type == GNRC_NETAPI_MSG_TYPE_ACK);
+    return (int)ack.content.value;
+}
@@ -26,18 +26,42 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#ifdef MODULE_GNRC_NETREG_HASH
+#if (GNRC_NETREG_HASH_BUCKETS & (GNRC_NETREG_HASH_BUCKETS - 1)) != 0
+#error "GNRC_NETREG_HASH_BUCKETS must be a power of two"
+#endif
+
+/* The registry as lookup table by gnrc_nettype_t and hashed demux_ctx */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][GNRC_NETREG_HASH_BUCKETS];
+
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    /* fold the upper half in, so GNRC_NETREG_DEMUX_CTX_ALL does not collide
+     * with the small demux contexts (next header numbers, ports) */
+    return &netreg[type][(demux_ctx ^ (demux_ctx >> 16)) &
+                         (GNRC_NETREG_HASH_BUCKETS - 1)];
+}
+#else
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    (void)demux_ctx;
+    return &netreg[type];
+}
+#endif
+
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_RING)
 #ifdef DEVELHELP
     /* only threads with a message queue are allowed to register at gnrc */
     assert((entry->type != GNRC_NETREG_TYPE_DEFAULT) ||
@@ -52,7 +76,19 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
+#ifdef MODULE_GNRC_NETREG_HASH
+    gnrc_netreg_entry_t **pos = _head(type, entry->demux_ctx);
+
+    /* keep entries with the same demux_ctx adjacent (newest first) so
+     * gnrc_netreg_getnext() only needs to look at the next entry */
+    while ((*pos != NULL) && ((*pos)->demux_ctx != entry->demux_ctx)) {
+        pos = &(*pos)->next;
+    }
+    entry->next = *pos;
+    *pos = entry;
+#else
     LL_PREPEND(netreg[type], entry);
+#endif
 
     return 0;
 }
@@ -63,7 +99,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_head(type, entry->demux_ctx), entry);
 }
 
 gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
@@ -74,31 +110,32 @@ gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
         return NULL;
     }
 
-    LL_SEARCH_SCALAR(netreg[type], res, demux_ctx, demux_ctx);
+    LL_SEARCH_SCALAR(*_head(type, demux_ctx), res, demux_ctx, demux_ctx);
 
     return res;
 }
 
 int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
 {
-    int num = 0;
-    gnrc_netreg_entry_t *entry;
+    int num;
 
-    if (_INVALID_TYPE(type)) {
-        return 0;
-    }
+    gnrc_netreg_lookup_num(type, demux_ctx, &num);
 
-    entry = netreg[type];
+    return num;
+}
 
-    while (entry != NULL) {
-        if (entry->demux_ctx == demux_ctx) {
-            num++;
-        }
+gnrc_netreg_entry_t *gnrc_netreg_lookup_num(gnrc_nettype_t type,
+                                            uint32_t demux_ctx, int *num)
+{
+    gnrc_netreg_entry_t *res = gnrc_netreg_lookup(type, demux_ctx);
 
-        entry = entry->next;
+    *num = 0;
+    for (gnrc_netreg_entry_t *entry = res; entry != NULL;
+         entry = gnrc_netreg_getnext(entry)) {
+        (*num)++;
     }
 
-    return num;
+    return res;
 }
 
 gnrc_netreg_entry_t *gnrc_netreg_getnext(gnrc_netreg_entry_t *entry)
@@ -111,9 +148,14 @@ gnrc_netreg_entry_t *gnrc_netreg_getnext(gnrc_netreg_entry_t *entry)
 
     demux_ctx = entry->demux_ctx;
 
+#ifdef MODULE_GNRC_NETREG_HASH
+    entry = entry->next;
+    return ((entry != NULL) && (entry->demux_ctx == demux_ctx)) ? entry : NULL;
+#else
     LL_SEARCH_SCALAR(entry->next, entry, demux_ctx, demux_ctx);
 
     return entry;
+#endif
 }
 
 int gnrc_netreg_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr)
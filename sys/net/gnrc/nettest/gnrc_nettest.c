@@ -248,6 +248,23 @@ static void *_event_loop(void *arg)
                                                    opt->context, opt->data,
                                                    opt->data_len);
                 break;
+
+            case GNRC_NETAPI_MSG_TYPE_OPTS: {
+                gnrc_netapi_opts_t *opts = msg.content.ptr;
+
+                for (unsigned i = 0; i < opts->numof; i++) {
+                    gnrc_netapi_opt_req_t *req = &opts->reqs[i];
+                    gnrc_nettest_opt_cb_t cb;
+
+                    cb = (req->type == GNRC_NETAPI_MSG_TYPE_SET) ?
+                         _opt_cbs[req->opt.opt].set : _opt_cbs[req->opt.opt].get;
+                    req->res = (int)_get_set_opt(cb, req->opt.context,
+                                                 req->opt.data,
+                                                 req->opt.data_len);
+                }
+                reply.content.value = (uint32_t)opts->numof;
+                break;
+            }
         }
 
         msg_reply(&msg, &reply);
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "irq.h"
+
+#include "net/gnrc/ipv6/dst_cache.h"
+#ifdef MODULE_FIB
+#include "net/gnrc/ipv6.h"
+#endif
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static gnrc_ipv6_dst_cache_t _cache[GNRC_IPV6_DST_CACHE_SIZE];
+/* entries of older generations are invalid, so 0 is skipped to keep the
+ * zero-initialized entries invalid */
+static volatile unsigned _gen = 1;
+/* next entry to replace */
+static unsigned _next;
+#ifdef MODULE_FIB
+/* generation of the FIB the entries were looked up in */
+static unsigned _fib_gen;
+#endif
+
+/* flushes the cache if the FIB changed since the last check */
+static void _check_fib(void)
+{
+#ifdef MODULE_FIB
+    unsigned fib_gen = fib_get_generation(&gnrc_ipv6_fib_table);
+
+    if (fib_gen != _fib_gen) {
+        _fib_gen = fib_gen;
+        gnrc_ipv6_dst_cache_flush();
+    }
+#endif
+}
+
+unsigned gnrc_ipv6_dst_cache_gen(void)
+{
+    _check_fib();
+    return _gen;
+}
+
+gnrc_ipv6_dst_cache_t *gnrc_ipv6_dst_cache_get(kernel_pid_t iface,
+                                               const ipv6_addr_t *dst)
+{
+    unsigned gen;
+
+    _check_fib();
+    gen = _gen;
+
+    for (unsigned i = 0; i < GNRC_IPV6_DST_CACHE_SIZE; i++) {
+        gnrc_ipv6_dst_cache_t *entry = &_cache[i];
+
+        if ((entry->gen == gen) && (entry->req_iface == iface) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+void gnrc_ipv6_dst_cache_add(unsigned gen, kernel_pid_t req_iface,
+                             const ipv6_addr_t *dst, kernel_pid_t iface,
+                             const uint8_t *l2addr, uint8_t l2addr_len,
+                             const ipv6_addr_t *src)
+{
+    gnrc_ipv6_dst_cache_t *entry = gnrc_ipv6_dst_cache_get(req_iface, dst);
+
+    assert(l2addr_len <= GNRC_IPV6_NC_L2_ADDR_MAX);
+    if (entry == NULL) {
+        entry = &_cache[_next];
+        _next = (_next + 1) % GNRC_IPV6_DST_CACHE_SIZE;
+    }
+    entry->gen = gen;
+    entry->req_iface = req_iface;
+    entry->iface = iface;
+    memcpy(&entry->dst, dst, sizeof(entry->dst));
+    if (src != NULL) {
+        memcpy(&entry->src, src, sizeof(entry->src));
+    }
+    else {
+        ipv6_addr_set_unspecified(&entry->src);
+    }
+    entry->l2addr_len = l2addr_len;
+    memcpy(entry->l2addr, l2addr, l2addr_len);
+}
+
+void gnrc_ipv6_dst_cache_flush(void)
+{
+    unsigned state = irq_disable();
+
+    DEBUG("ipv6 dst cache: flush\n");
+    if (++_gen == 0) {
+        _gen = 1;
+    }
+    irq_restore(state);
+}
+
+/** @} */
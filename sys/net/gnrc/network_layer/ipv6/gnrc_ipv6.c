@@ -26,9 +26,11 @@
 #include "net/gnrc/sixlowpan/nd.h"
 #include "net/gnrc/sixlowpan/nd/router.h"
 #include "net/protnum.h"
+#include "net/udp.h"
 #include "thread.h"
 #include "utlist.h"
 
+#include "net/gnrc/ipv6/dst_cache.h"
 #include "net/gnrc/ipv6/nc.h"
 #include "net/gnrc/ipv6/netif.h"
 #include "net/gnrc/ipv6/whitelist.h"
@@ -138,9 +140,11 @@ void gnrc_ipv6_demux(kernel_pid_t iface, gnrc_pktsnip_t *current, gnrc_pktsnip_t
             break;
         default:
             (void)iface;
-#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+#if defined(MODULE_GNRC_SIXLOWPAN_IPHC_NHC) || \
+    defined(MODULE_GNRC_IPV6_LOOPBACK_ZEROCOPY)
             /* second statement is true for small 6LoWPAN NHC decompressed frames
-             * since in this case it looks like
+             * and UDP packets looped back without copying since in this case
+             * it looks like
              *
              * * GNRC_NETTYPE_UNDEF <- pkt
              * v
@@ -251,6 +255,8 @@ static void _dispatch_next_header(gnrc_pktsnip_t *current, gnrc_pktsnip_t *pkt,
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+    msg_t msg_bulk[GNRC_IPV6_MSG_BULK_SIZE];
+    unsigned msg_num = 0, msg_idx = 0;
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
 
@@ -265,8 +271,12 @@ static void *_event_loop(void *args)
 
     /* start event loop */
     while (1) {
-        DEBUG("ipv6: waiting for incoming message.\n");
-        msg_receive(&msg);
+        if (msg_idx == msg_num) {
+            DEBUG("ipv6: waiting for incoming message.\n");
+            msg_num = msg_receive_bulk(msg_bulk, GNRC_IPV6_MSG_BULK_SIZE);
+            msg_idx = 0;
+        }
+        msg = msg_bulk[msg_idx++];
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -290,6 +300,9 @@ static void *_event_loop(void *args)
             case GNRC_NDP_MSG_RTR_TIMEOUT:
                 DEBUG("ipv6: Router timeout received\n");
                 ((gnrc_ipv6_nc_t *)msg.content.ptr)->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+                gnrc_ipv6_dst_cache_flush();
+#endif
                 break;
 
             /* XXX reactivate when https://github.com/RIOT-OS/RIOT/issues/5122 is
@@ -654,6 +667,75 @@ static inline kernel_pid_t _next_hop_l2addr(uint8_t *l2addr, uint8_t *l2addr_len
     return found_iface;
 }
 
+#ifdef MODULE_GNRC_IPV6_LOOPBACK_ZEROCOPY
+/* Turns a packet built for sending into one as if received, without copying
+ * it. The receive path takes over the IPv6 and UDP header snips as they are,
+ * but upper layers expect their payload in a single snip, so only if it is
+ * spread over more than one, it is merged. Releases pkt on error. */
+static gnrc_pktsnip_t *_loopback_pkt(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *ipv6)
+{
+    gnrc_pktsnip_t *hdr = ipv6, *rcv_pkt = NULL;
+
+    if (ipv6 != pkt) {
+        /* netif header was already write-protected in _send() */
+        pkt = gnrc_pktbuf_remove_snip(pkt, pkt);
+    }
+#ifdef MODULE_GNRC_UDP
+    if ((hdr->next != NULL) && (hdr->next->type == GNRC_NETTYPE_UDP) &&
+        (hdr->next->size == sizeof(udp_hdr_t))) {
+        gnrc_pktsnip_t *udp = gnrc_pktbuf_start_write(hdr->next);
+
+        if (udp == NULL) {
+            DEBUG("ipv6: unable to get write access to UDP header\n");
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+        hdr->next = udp;
+        hdr = udp;
+    }
+#endif
+    if ((hdr->next != NULL) && (hdr->next->next != NULL)) {
+        gnrc_pktsnip_t *payload = hdr->next, *ptr = payload;
+        uint8_t *data;
+
+        DEBUG("ipv6: merge payload for loopback\n");
+        hdr->next = gnrc_pktbuf_add(NULL, NULL, gnrc_pkt_len(payload),
+                                    GNRC_NETTYPE_UNDEF);
+        if (hdr->next == NULL) {
+            hdr->next = payload;
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+        data = hdr->next->data;
+        while (ptr != NULL) {
+            memcpy(data, ptr->data, ptr->size);
+            data += ptr->size;
+            ptr = ptr->next;
+        }
+        gnrc_pktbuf_release(payload);
+    }
+
+    /* "reverse" packet (by reversing the order of its snips as if received
+     * from NIC) */
+    while (pkt != NULL) {
+        gnrc_pktsnip_t *next = pkt->next, *ptr;
+
+        ptr = gnrc_pktbuf_start_write(pkt);     /* duplicate if shared */
+        if (ptr == NULL) {
+            DEBUG("ipv6: unable to get write access to packet\n");
+            gnrc_pktbuf_release(rcv_pkt);
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+        ptr->next = rcv_pkt;
+        rcv_pkt = ptr;
+        pkt = next;
+    }
+
+    return rcv_pkt;
+}
+#endif
+
 static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
 {
     kernel_pid_t iface = KERNEL_PID_UNDEF;
@@ -698,16 +780,41 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
     hdr = ipv6->data;
     payload = ipv6->next;
 
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    /* read before any of the lookups the cache entry is built from */
+    unsigned gen = gnrc_ipv6_dst_cache_gen();
+    kernel_pid_t req_iface = iface;
+    gnrc_ipv6_dst_cache_t *dst_cache;
+#endif
+
     if (ipv6_addr_is_multicast(&hdr->dst)) {
         _send_multicast(iface, pkt, ipv6, payload, prep_hdr);
     }
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    else if ((dst_cache = gnrc_ipv6_dst_cache_get(iface, &hdr->dst)) != NULL) {
+        DEBUG("ipv6: found destination in destination cache\n");
+        if (prep_hdr) {
+            if (ipv6_addr_is_unspecified(&hdr->src)) {
+                /* _fill_ipv6_hdr() only selects a source if there is none */
+                memcpy(&hdr->src, &dst_cache->src, sizeof(hdr->src));
+            }
+            if (_fill_ipv6_hdr(dst_cache->iface, ipv6, payload) < 0) {
+                /* error on filling up header */
+                gnrc_pktbuf_release(pkt);
+                return;
+            }
+        }
+
+        _send_unicast(dst_cache->iface, dst_cache->l2addr,
+                      dst_cache->l2addr_len, pkt);
+    }
+#endif
     else if ((ipv6_addr_is_loopback(&hdr->dst)) ||      /* dst is loopback address */
              ((iface == KERNEL_PID_UNDEF) && /* or dst registered to any local interface */
               ((iface = gnrc_ipv6_netif_find_by_addr(&tmp, &hdr->dst)) != KERNEL_PID_UNDEF)) ||
              ((iface != KERNEL_PID_UNDEF) && /* or dst registered to given interface */
               (gnrc_ipv6_netif_find_addr(iface, &hdr->dst) != NULL))) {
-        uint8_t *rcv_data;
-        gnrc_pktsnip_t *ptr = ipv6, *rcv_pkt;
+        gnrc_pktsnip_t *rcv_pkt;
 
         if (prep_hdr) {
             if (_fill_ipv6_hdr(iface, ipv6, payload) < 0) {
@@ -717,6 +824,15 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
             }
         }
 
+#ifdef MODULE_GNRC_IPV6_LOOPBACK_ZEROCOPY
+        if ((rcv_pkt = _loopback_pkt(pkt, ipv6)) == NULL) {
+            DEBUG("ipv6: error on generating loopback packet\n");
+            return;
+        }
+#else
+        uint8_t *rcv_data;
+        gnrc_pktsnip_t *ptr = ipv6;
+
         rcv_pkt = gnrc_pktbuf_add(NULL, NULL, gnrc_pkt_len(ipv6), GNRC_NETTYPE_IPV6);
 
         if (rcv_pkt == NULL) {
@@ -735,6 +851,7 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
         }
 
         gnrc_pktbuf_release(pkt);
+#endif
 
         DEBUG("ipv6: packet is addressed to myself => loopback\n");
 
@@ -755,6 +872,10 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
             return;
         }
 
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+        bool select_src = prep_hdr && ipv6_addr_is_unspecified(&hdr->src);
+#endif
+
         if (prep_hdr) {
             if (_fill_ipv6_hdr(iface, ipv6, payload) < 0) {
                 /* error on filling up header */
@@ -763,6 +884,10 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
             }
         }
 
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+        gnrc_ipv6_dst_cache_add(gen, req_iface, &hdr->dst, iface, l2addr,
+                                l2addr_len, select_src ? &hdr->src : NULL);
+#endif
         _send_unicast(iface, l2addr, l2addr_len, pkt);
     }
 }
@@ -17,6 +17,7 @@
 
 #include "net/gnrc/ipv6.h"
 #include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/dst_cache.h"
 #include "net/gnrc/ipv6/nc.h"
 #include "net/gnrc/ipv6/netif.h"
 #include "net/gnrc/ndp.h"
@@ -76,6 +77,9 @@ static void _nc_remove(kernel_pid_t iface, gnrc_ipv6_nc_t *entry)
     ipv6_addr_set_unspecified(&(entry->ipv6_addr));
     entry->iface = KERNEL_PID_UNDEF;
     entry->flags = 0;
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    gnrc_ipv6_dst_cache_flush();
+#endif
 }
 
 void gnrc_ipv6_nc_init(void)
@@ -128,6 +132,9 @@ gnrc_ipv6_nc_t *gnrc_ipv6_nc_add(kernel_pid_t iface, const ipv6_addr_t *ipv6_add
                 ncache[i].l2_addr_len = l2_addr_len;
                 ncache[i].flags = flags;
                 DEBUG(" with flags = 0x%0x\n", flags);
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+                gnrc_ipv6_dst_cache_flush();
+#endif
 
             }
             return &ncache[i];
@@ -187,6 +194,9 @@ gnrc_ipv6_nc_t *gnrc_ipv6_nc_add(kernel_pid_t iface, const ipv6_addr_t *ipv6_add
 #endif
 
     free_entry->nbr_sol_msg.content.ptr = free_entry;
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    gnrc_ipv6_dst_cache_flush();
+#endif
 
     return free_entry;
 }
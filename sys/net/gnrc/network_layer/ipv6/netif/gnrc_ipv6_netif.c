@@ -157,6 +157,9 @@ static ipv6_addr_t *_add_addr_to_entry(gnrc_ipv6_netif_t *entry, const ipv6_addr
 
     tmp_addr->valid_timeout_msg.type = GNRC_NDP_MSG_ADDR_TIMEOUT;
     tmp_addr->valid_timeout_msg.content.ptr = &tmp_addr->addr;
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    gnrc_ipv6_dst_cache_flush();
+#endif
 
     return &(tmp_addr->addr);
 }
@@ -165,6 +168,9 @@ static void _reset_addr_from_entry(gnrc_ipv6_netif_t *entry)
 {
     DEBUG("ipv6 netif: Reset IPv6 addresses on interface %" PRIkernel_pid "\n", entry->pid);
     memset(entry->addrs, 0, sizeof(entry->addrs));
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    gnrc_ipv6_dst_cache_flush();
+#endif
 }
 
 static void _ipv6_netif_remove(gnrc_ipv6_netif_t *entry)
@@ -322,6 +328,9 @@ static void _remove_addr_from_entry(gnrc_ipv6_netif_t *entry, ipv6_addr_t *addr)
                   ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), entry->pid);
             ipv6_addr_set_unspecified(&(entry->addrs[i].addr));
             entry->addrs[i].flags = 0;
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+            gnrc_ipv6_dst_cache_flush();
+#endif
 #ifdef MODULE_GNRC_NDP_ROUTER
             /* Removal of prefixes MAY allow the router to retransmit up to
              * GNRC_NDP_MAX_INIT_RTR_ADV_NUMOF unsolicited RA
@@ -798,8 +807,24 @@ void gnrc_ipv6_netif_init_by_dev(void)
     for (size_t i = 0; i < ifnum; i++) {
         ipv6_addr_t addr;
         eui64_t iid;
-        uint16_t tmp;
+        uint16_t src_len = 8;
+        uint16_t max_pkt_size = UINT16_MAX;
         gnrc_ipv6_netif_t *ipv6_if = gnrc_ipv6_netif_get(ifs[i]);
+        /* query everything in one round trip through the interface's thread
+         * instead of one per option */
+        gnrc_netapi_opt_req_t reqs[] = {
+            { .type = GNRC_NETAPI_MSG_TYPE_SET,
+              .opt = { NETOPT_SRC_LEN, 0, &src_len, sizeof(src_len) } },
+            { .type = GNRC_NETAPI_MSG_TYPE_GET,
+              .opt = { NETOPT_MAX_PACKET_SIZE, 0, &max_pkt_size,
+                       sizeof(max_pkt_size) } },
+            { .type = GNRC_NETAPI_MSG_TYPE_GET,
+              .opt = { NETOPT_IPV6_IID, 0, &iid, sizeof(eui64_t) } },
+            { .type = GNRC_NETAPI_MSG_TYPE_GET,
+              .opt = { NETOPT_IS_WIRED, 0, NULL, 0 } },
+        };
+        /* NETOPT_SRC_LEN is only set for 6LoWPAN interfaces */
+        gnrc_netapi_opt_req_t *first = &reqs[1];
 
         if (ipv6_if == NULL) {
             continue;
@@ -813,9 +838,6 @@ void gnrc_ipv6_netif_init_by_dev(void)
         if ((gnrc_netapi_get(ifs[i], NETOPT_PROTO, 0, &if_type,
                              sizeof(if_type)) != -ENOTSUP) &&
             (if_type == GNRC_NETTYPE_SIXLOWPAN)) {
-            uint16_t src_len = 8;
-            uint16_t max_frag_size = UINT16_MAX;
-
             DEBUG("ipv6 netif: Set 6LoWPAN flag\n");
             ipv6_ifs[i].flags |= GNRC_IPV6_NETIF_FLAGS_SIXLOWPAN;
 
@@ -829,24 +851,29 @@ void gnrc_ipv6_netif_init_by_dev(void)
             ipv6_ifs[i].flags |= GNRC_IPV6_NETIF_FLAGS_ROUTER;
 #endif
             /* use EUI-64 (8-byte address) for IID generation and for sending
-             * packets */
-            gnrc_netapi_set(ifs[i], NETOPT_SRC_LEN, 0, &src_len,
-                            sizeof(src_len)); /* don't care for result */
+             * packets (don't care for result). Set before the IID is
+             * requested, since it depends on the source address length */
+            first = &reqs[0];
+        }
+#endif
 
-            if (gnrc_netapi_get(ifs[i], NETOPT_MAX_PACKET_SIZE,
-                                0, &max_frag_size, sizeof(max_frag_size)) < 0) {
+        gnrc_netapi_opts(ifs[i], first,
+                         &reqs[sizeof(reqs) / sizeof(reqs[0])] - first);
+
+#ifdef MODULE_GNRC_SIXLOWPAN
+        if (first == &reqs[0]) {
+            if (reqs[1].res < 0) {
                 /* if error we assume it works */
                 DEBUG("ipv6 netif: Can not get max packet size from interface %"
                       PRIkernel_pid "\n", ifs[i]);
             }
 
-            gnrc_sixlowpan_netif_add(ifs[i], max_frag_size);
+            gnrc_sixlowpan_netif_add(ifs[i], max_pkt_size);
         }
 #endif
 
         /* set link-local address */
-        if (gnrc_netapi_get(ifs[i], NETOPT_IPV6_IID, 0, &iid,
-                            sizeof(eui64_t)) >= 0) {
+        if (reqs[2].res >= 0) {
             ipv6_addr_set_aiid(&addr, iid.uint8);
             ipv6_addr_set_link_local_prefix(&addr);
             _add_addr_to_entry(ipv6_if, &addr, 64, 0);
@@ -854,16 +881,15 @@ void gnrc_ipv6_netif_init_by_dev(void)
         }
 
         /* set link MTU */
-        if ((gnrc_netapi_get(ifs[i], NETOPT_MAX_PACKET_SIZE, 0, &tmp,
-                             sizeof(uint16_t)) >= 0)) {
-            if (tmp >= IPV6_MIN_MTU) {
-                ipv6_if->mtu = tmp;
+        if (reqs[1].res >= 0) {
+            if (max_pkt_size >= IPV6_MIN_MTU) {
+                ipv6_if->mtu = max_pkt_size;
             }
             /* otherwise leave at GNRC_IPV6_NETIF_DEFAULT_MTU as initialized in
              * gnrc_ipv6_netif_add() */
         }
 
-        if (gnrc_netapi_get(ifs[i], NETOPT_IS_WIRED, 0, NULL, 0) > 0) {
+        if (reqs[3].res > 0) {
             ipv6_if->flags |= GNRC_IPV6_NETIF_FLAGS_IS_WIRED;
         }
         else {
@@ -314,6 +314,10 @@ void gnrc_ndp_nbr_adv_handle(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
                 nc_entry->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
                 /* TODO: update state of neighbor as router in FIB? */
             }
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+            /* link-layer address or router flag may have changed */
+            gnrc_ipv6_dst_cache_flush();
+#endif
 #ifdef MODULE_GNRC_NDP_NODE
             gnrc_pktqueue_t *queued_pkt;
             while ((queued_pkt = gnrc_pktqueue_remove_head(&nc_entry->pkts)) != NULL) {
@@ -362,6 +366,10 @@ void gnrc_ndp_nbr_adv_handle(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
                     nc_entry->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
                     /* TODO: update state of neighbor as router in FIB? */
                 }
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+                /* link-layer address or router flag may have changed */
+                gnrc_ipv6_dst_cache_flush();
+#endif
             }
             else if (l2tgt_changed &&
                      gnrc_ipv6_nc_get_state(nc_entry) == GNRC_IPV6_NC_STATE_REACHABLE) {
@@ -472,6 +480,9 @@ void gnrc_ndp_rtr_sol_handle(kernel_pid_t iface, gnrc_pktsnip_t *pkt,
             /* unset isRouter flag
              * (https://tools.ietf.org/html/rfc4861#section-6.2.6) */
             nc_entry->flags &= ~GNRC_IPV6_NC_IS_ROUTER;
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+            gnrc_ipv6_dst_cache_flush();
+#endif
         }
     }
     /* otherwise ignore silently */
@@ -527,6 +538,9 @@ void gnrc_ndp_rtr_adv_handle(kernel_pid_t iface, gnrc_pktsnip_t *pkt, ipv6_hdr_t
     else {
         nc_entry->flags |= GNRC_IPV6_NC_IS_ROUTER;
     }
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    gnrc_ipv6_dst_cache_flush();
+#endif
     /* set router life timer */
     if (rtr_adv->ltime.u16 != 0) {
         uint16_t ltime = byteorder_ntohs(rtr_adv->ltime);
@@ -95,6 +95,9 @@ void gnrc_ndp_internal_set_state(gnrc_ipv6_nc_t *nc_entry, uint8_t state)
 
     nc_entry->flags &= ~GNRC_IPV6_NC_STATE_MASK;
     nc_entry->flags |= state;
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    gnrc_ipv6_dst_cache_flush();
+#endif
 
     DEBUG("ndp internal: set %s state to ",
           ipv6_addr_to_str(addr_str, &nc_entry->ipv6_addr, sizeof(addr_str)));
@@ -47,8 +47,24 @@ static inline size_t _min(size_t a, size_t b)
     return (a < b) ? a : b;
 }
 
-static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, size_t payload_len,
-                                       size_t size)
+static inline uint16_t _max_1st_frag_size(gnrc_sixlowpan_netif_t *iface,
+                                          int payload_diff)
+{
+    /* virtually add payload_diff to flooring to account for offset (must be divisable by 8)
+     * in uncompressed datagram */
+    return _floor8(iface->max_frag_size + payload_diff -
+                   sizeof(sixlowpan_frag_t)) - payload_diff;
+}
+
+static inline uint16_t _max_nth_frag_size(gnrc_sixlowpan_netif_t *iface)
+{
+    /* since dispatches aren't supposed to go into subsequent fragments, we need not account
+     * for payload difference as for the first fragment */
+    return _floor8(iface->max_frag_size - sizeof(sixlowpan_frag_n_t));
+}
+
+static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *payload,
+                                       size_t payload_len, size_t size)
 {
     gnrc_netif_hdr_t *hdr = pkt->data, *new_hdr;
     gnrc_pktsnip_t *netif, *frag;
@@ -67,7 +83,7 @@ static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, size_t payload_len,
     new_hdr->rssi = hdr->rssi;
     new_hdr->lqi = hdr->lqi;
 
-    frag = gnrc_pktbuf_add(NULL, NULL, _min(size, payload_len),
+    frag = gnrc_pktbuf_add(payload, NULL, _min(size, payload_len),
                            GNRC_NETTYPE_SIXLOWPAN);
 
     if (frag == NULL) {
@@ -89,16 +105,13 @@ static uint16_t _send_1st_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
     /* payload_len: actual size of the packet vs
      * datagram_size: size of the uncompressed IPv6 packet */
     int payload_diff = (datagram_size - payload_len);
-    /* virtually add payload_diff to flooring to account for offset (must be divisable by 8)
-     * in uncompressed datagram */
-    uint16_t max_frag_size = _floor8(iface->max_frag_size + payload_diff -
-                                     sizeof(sixlowpan_frag_t)) - payload_diff;
+    uint16_t max_frag_size = _max_1st_frag_size(iface, payload_diff);
     sixlowpan_frag_t *hdr;
     uint8_t *data;
 
     DEBUG("6lo frag: determined max_frag_size = %" PRIu16 "\n", max_frag_size);
 
-    frag = _build_frag_pkt(pkt, payload_len,
+    frag = _build_frag_pkt(pkt, NULL, payload_len,
                            max_frag_size + sizeof(sixlowpan_frag_t));
 
     if (frag == NULL) {
@@ -143,16 +156,14 @@ static uint16_t _send_nth_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
                                    uint16_t offset)
 {
     gnrc_pktsnip_t *frag;
-    /* since dispatches aren't supposed to go into subsequent fragments, we need not account
-     * for payload difference as for the first fragment */
-    uint16_t max_frag_size = _floor8(iface->max_frag_size - sizeof(sixlowpan_frag_n_t));
+    uint16_t max_frag_size = _max_nth_frag_size(iface);
     uint16_t local_offset = 0, offset_count = 0;
     sixlowpan_frag_n_t *hdr;
     uint8_t *data;
 
     DEBUG("6lo frag: determined max_frag_size = %" PRIu16 "\n", max_frag_size);
 
-    frag = _build_frag_pkt(pkt,
+    frag = _build_frag_pkt(pkt, NULL,
                            payload_len - offset + sizeof(sixlowpan_frag_n_t),
                            max_frag_size + sizeof(sixlowpan_frag_n_t));
 
@@ -216,6 +227,137 @@ static uint16_t _send_nth_fragment(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t
     return local_offset;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_PIPELINE
+/**
+ * @brief   Checks if no snip of the payload of @p pkt is referenced elsewhere,
+ *          so the payload may be split up between the fragments
+ */
+static bool _payload_exclusive(gnrc_pktsnip_t *pkt)
+{
+    for (pkt = pkt->next; pkt != NULL; pkt = pkt->next) {
+        if (pkt->users > 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   Cuts the first @p size bytes off a payload chain
+ *
+ * A snip crossing the cut is split with gnrc_pktbuf_mark(), which does not
+ * copy its data.
+ *
+ * @param[in,out] payload   The payload chain. Its remainder on return.
+ * @param[in] size          Number of bytes to cut off.
+ *
+ * @return  The chain of the first @p size bytes (or less at the end).
+ * @return  NULL, if a snip could not be split. @p payload stays unchanged then.
+ */
+static gnrc_pktsnip_t *_cut_payload(gnrc_pktsnip_t **payload, size_t size)
+{
+    gnrc_pktsnip_t *head = *payload, *last = NULL, *snip = head;
+
+    while ((snip != NULL) && (size >= snip->size)) {
+        size -= snip->size;
+        last = snip;
+        snip = snip->next;
+    }
+    if ((snip != NULL) && (size > 0)) {
+        /* the marked front part is inserted behind the rest of the snip */
+        gnrc_pktsnip_t *front = gnrc_pktbuf_mark(snip, size, snip->type);
+
+        if (front == NULL) {
+            return NULL;
+        }
+        snip->next = front->next;
+        front->next = NULL;
+        if (last == NULL) {
+            head = front;
+        }
+        else {
+            last->next = front;
+        }
+    }
+    else if (last != NULL) {
+        last->next = NULL;
+    }
+    *payload = snip;
+
+    return head;
+}
+
+/**
+ * @brief   Sends all fragments of a datagram in one go
+ *
+ * The payload of @p pkt is cut into the fragments' payloads instead of being
+ * copied, each fragment only gets its own link-layer and fragment header.
+ */
+static void _send_pipelined(gnrc_sixlowpan_netif_t *iface, gnrc_pktsnip_t *pkt,
+                            size_t payload_len, size_t datagram_size)
+{
+    gnrc_pktsnip_t *payload = pkt->next;
+    int payload_diff = (datagram_size - payload_len);
+    size_t offset = 0;
+
+    /* keep the netif header as template for the fragments' headers */
+    pkt->next = NULL;
+
+    while (payload != NULL) {
+        gnrc_pktsnip_t *data, *frag;
+        sixlowpan_frag_n_t *hdr;
+        size_t hdr_size, frag_size;
+
+        if (offset == 0) {
+            hdr_size = sizeof(sixlowpan_frag_t);
+            frag_size = _max_1st_frag_size(iface, payload_diff);
+        }
+        else {
+            hdr_size = sizeof(sixlowpan_frag_n_t);
+            frag_size = _max_nth_frag_size(iface);
+        }
+        frag_size = _min(frag_size, payload_len - offset);
+
+        if ((data = _cut_payload(&payload, frag_size)) == NULL) {
+            DEBUG("6lo frag: unable to split payload at offset %u\n",
+                  (unsigned)offset);
+            break;
+        }
+        if ((frag = _build_frag_pkt(pkt, data, hdr_size, hdr_size)) == NULL) {
+            gnrc_pktbuf_release(data);
+            break;
+        }
+
+        hdr = frag->next->data;
+        /* XXX: truncation of datagram_size > 4095 may happen here */
+        hdr->disp_size = byteorder_htons((uint16_t)datagram_size);
+        hdr->tag = byteorder_htons(_tag);
+        if (offset == 0) {
+            hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        }
+        else {
+            hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+            /* don't mention payload diff in offset */
+            hdr->offset = (uint8_t)((offset + payload_diff) >> 3);
+        }
+
+        DEBUG("6lo frag: send fragment (datagram size: %u, datagram tag: %"
+              PRIu16 ", offset: %u, fragment size: %u)\n",
+              (unsigned)datagram_size, _tag, (unsigned)offset,
+              (unsigned)frag_size);
+        if (gnrc_netapi_send(iface->pid, frag) < 1) {
+            DEBUG("6lo frag: unable to send fragment\n");
+            gnrc_pktbuf_release(frag);
+        }
+        offset += frag_size;
+    }
+
+    /* release what could not be sent and the template */
+    gnrc_pktbuf_release(payload);
+    gnrc_pktbuf_release(pkt);
+}
+#endif
+
 void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
 {
     gnrc_sixlowpan_netif_t *iface = gnrc_sixlowpan_netif_get(fragment_msg->pid);
@@ -223,7 +365,9 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
     /* payload_len: actual size of the packet vs
      * datagram_size: size of the uncompressed IPv6 packet */
     size_t payload_len = gnrc_pkt_len(fragment_msg->pkt->next);
+#ifndef MODULE_GNRC_SIXLOWPAN_FRAG_PIPELINE
     msg_t msg;
+#endif
 
 #if defined(DEVELHELP) && defined(ENABLE_DEBUG)
     if (iface == NULL) {
@@ -236,6 +380,28 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
     }
 #endif
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_PIPELINE
+    /* increment tag for successive, fragmented datagrams */
+    _tag++;
+    if (_payload_exclusive(fragment_msg->pkt)) {
+        _send_pipelined(iface, fragment_msg->pkt, payload_len,
+                        fragment_msg->datagram_size);
+    }
+    else {
+        /* shared snips must stay intact, so copy them, but still in one go */
+        res = _send_1st_fragment(iface, fragment_msg->pkt, payload_len,
+                                 fragment_msg->datagram_size);
+        fragment_msg->offset = res;
+        while ((res != 0) && (fragment_msg->offset < payload_len)) {
+            res = _send_nth_fragment(iface, fragment_msg->pkt, payload_len,
+                                     fragment_msg->datagram_size,
+                                     fragment_msg->offset);
+            fragment_msg->offset += res;
+        }
+        gnrc_pktbuf_release(fragment_msg->pkt);
+    }
+    fragment_msg->pkt = NULL;
+#else
     /* Check weater to send the first or an Nth fragment */
     if (fragment_msg->offset == 0) {
         /* increment tag for successive, fragmented datagrams */
@@ -280,6 +446,7 @@ void gnrc_sixlowpan_frag_send(gnrc_sixlowpan_msg_frag_t *fragment_msg)
             fragment_msg->pkt = NULL;
         }
     }
+#endif
 }
 
 void gnrc_sixlowpan_frag_handle_pkt(gnrc_pktsnip_t *pkt)
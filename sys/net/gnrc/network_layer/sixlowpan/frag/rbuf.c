@@ -22,6 +22,7 @@
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/sixlowpan.h"
+#include "net/udp.h"
 #include "thread.h"
 #include "xtimer.h"
 #include "utlist.h"
@@ -45,6 +46,7 @@
 static rbuf_int_t rbuf_int[RBUF_INT_SIZE];
 
 static rbuf_t rbuf[RBUF_SIZE];
+static rbuf_t *rbuf_index[RBUF_BUCKETS];
 
 #if ENABLE_DEBUG
 static char l2addr_str[3 * RBUF_L2ADDR_MAX_LEN];
@@ -57,10 +59,20 @@ static char l2addr_str[3 * RBUF_L2ADDR_MAX_LEN];
 static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end);
 /* gets a free entry from interval buffer */
 static rbuf_int_t *_rbuf_int_get_free(void);
+/* checks whether the entry is in use */
+static inline bool _rbuf_used(const rbuf_t *entry);
+/* gets the size of the entry's datagram */
+static inline size_t _rbuf_size(const rbuf_t *entry);
 /* remove entry from reassembly buffer */
 static void _rbuf_rem(rbuf_t *entry);
+/* remove entry from reassembly buffer and release its data */
+static void _rbuf_drop(rbuf_t *entry);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+/* puts the datagram of a complete entry together */
+static gnrc_pktsnip_t *_rbuf_linearize(rbuf_t *entry);
+#endif
 /* update interval buffer of entry */
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size);
+static rbuf_int_t *_rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size);
 /* checks timeouts and removes entries if necessary (oldest if full) */
 static void _rbuf_gc(void);
 /* gets an entry identified by its tupel */
@@ -79,6 +91,9 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     sixlowpan_frag_t *frag = pkt->data;
     rbuf_int_t *ptr;
     uint8_t *data = ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+    gnrc_pktsnip_t *hdr = NULL;
+#endif
 
     _rbuf_gc();
     entry = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
@@ -102,14 +117,35 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
         else if (sixlowpan_iphc_is(data)) {
             size_t iphc_len, nh_len = 0;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+            /* decompress into a header of its own, the payload stays in the
+             * fragment */
+            hdr = gnrc_pktbuf_add(NULL, NULL, sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t),
+                                  GNRC_NETTYPE_IPV6);
+            if (hdr == NULL) {
+                DEBUG("6lo rfrag: can not allocate header space\n");
+                _rbuf_drop(entry);
+                return;
+            }
+            memset(hdr->data, 0, hdr->size);
+            iphc_len = gnrc_sixlowpan_iphc_decode(&hdr, pkt, entry->size,
+                                                  sizeof(sixlowpan_frag_t), &nh_len);
+            if ((iphc_len == 0) ||
+                (gnrc_pktbuf_realloc_data(hdr, sizeof(ipv6_hdr_t) + nh_len) != 0)) {
+                DEBUG("6lo rfrag: could not decode IPHC dispatch\n");
+                gnrc_pktbuf_release(hdr);
+                _rbuf_drop(entry);
+                return;
+            }
+#else
             iphc_len = gnrc_sixlowpan_iphc_decode(&entry->pkt, pkt, entry->pkt->size,
                                                   sizeof(sixlowpan_frag_t), &nh_len);
             if (iphc_len == 0) {
                 DEBUG("6lo rfrag: could not decode IPHC dispatch\n");
-                gnrc_pktbuf_release(entry->pkt);
-                _rbuf_rem(entry);
+                _rbuf_drop(entry);
                 return;
             }
+#endif
             data += iphc_len;       /* take remaining data as data */
             frag_size -= iphc_len;  /* and reduce frag size by IPHC dispatch length */
             /* but add IPv6 header + next header lengths */
@@ -123,10 +159,12 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         data++; /* FRAGN header is one byte longer (offset) */
     }
 
-    if ((offset + frag_size) > entry->pkt->size) {
+    if ((offset + frag_size) > _rbuf_size(entry)) {
         DEBUG("6lo rfrag: fragment too big for resulting datagram, discarding datagram\n");
-        gnrc_pktbuf_release(entry->pkt);
-        _rbuf_rem(entry);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+        gnrc_pktbuf_release(hdr);
+#endif
+        _rbuf_drop(entry);
         return;
     }
 
@@ -136,8 +174,10 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     while (ptr != NULL) {
         if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
             DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
-            gnrc_pktbuf_release(entry->pkt);
-            _rbuf_rem(entry);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+            gnrc_pktbuf_release(hdr);
+#endif
+            _rbuf_drop(entry);
 
             /* "A fresh reassembly may be commenced with the most recently
              * received link fragment"
@@ -147,26 +187,64 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
             return;
         }
 
+        if ((ptr->start == offset) && (ptr->end == (offset + frag_size - 1))) {
+            /* a retransmission of a fragment we already have */
+            DEBUG("6lo rfrag: duplicate fragment, ignoring it\n");
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+            gnrc_pktbuf_release(hdr);
+#endif
+            return;
+        }
+
         ptr = ptr->next;
     }
 
-    if (_rbuf_update_ints(entry, offset, frag_size)) {
+    if ((ptr = _rbuf_update_ints(entry, offset, frag_size)) != NULL) {
         DEBUG("6lo rbuf: add fragment data\n");
         entry->cur_size += (uint16_t)frag_size;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+        /* keep the fragment instead of copying its data */
+        gnrc_pktbuf_hold(pkt, 1);
+        ptr->frag = pkt;
+        ptr->data = data;
+        if (hdr != NULL) {
+            entry->hdr = hdr;
+            hdr = NULL;
+        }
+#else
         memcpy(((uint8_t *)entry->pkt->data) + offset + data_offset, data,
                frag_size - data_offset);
+#endif
     }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+    if (hdr != NULL) {
+        /* the fragment was not added */
+        gnrc_pktbuf_release(hdr);
+    }
+    (void)data_offset;
+#endif
 
-    if (entry->cur_size == entry->pkt->size) {
+    if (entry->cur_size == _rbuf_size(entry)) {
         gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(entry->src, entry->src_len,
                                                      entry->dst, entry->dst_len);
 
         if (netif == NULL) {
             DEBUG("6lo rbuf: error allocating netif header\n");
-            gnrc_pktbuf_release(entry->pkt);
-            _rbuf_rem(entry);
+            _rbuf_drop(entry);
             return;
         }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+        gnrc_pktsnip_t *datagram = _rbuf_linearize(entry);
+
+        if (datagram == NULL) {
+            DEBUG("6lo rbuf: error allocating datagram\n");
+            gnrc_pktbuf_release(netif);
+            _rbuf_drop(entry);
+            return;
+        }
+#else
+        gnrc_pktsnip_t *datagram = entry->pkt;
+#endif
 
         /* copy the transmit information of the latest fragment into the newly
          * created header to have some link_layer information. The link_layer
@@ -177,15 +255,16 @@ void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         new_netif_hdr->flags = netif_hdr->flags;
         new_netif_hdr->lqi = netif_hdr->lqi;
         new_netif_hdr->rssi = netif_hdr->rssi;
-        LL_APPEND(entry->pkt, netif);
+        LL_APPEND(datagram, netif);
+
+        /* the datagram is handed over, only the fragments are released */
+        _rbuf_rem(entry);
 
         if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL,
-                                          entry->pkt)) {
+                                          datagram)) {
             DEBUG("6lo rbuf: No receivers for this packet found\n");
-            gnrc_pktbuf_release(entry->pkt);
+            gnrc_pktbuf_release(datagram);
         }
-
-        _rbuf_rem(entry);
     }
 }
 
@@ -207,21 +286,122 @@ static rbuf_int_t *_rbuf_int_get_free(void)
     return NULL;
 }
 
+static inline bool _rbuf_used(const rbuf_t *entry)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+    return (entry->size != 0);
+#else
+    return (entry->pkt != NULL);
+#endif
+}
+
+static inline size_t _rbuf_size(const rbuf_t *entry)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+    return entry->size;
+#else
+    return entry->pkt->size;
+#endif
+}
+
+static inline rbuf_t **_rbuf_bucket(const void *src, size_t src_len,
+                                    const void *dst, size_t dst_len,
+                                    size_t size, uint16_t tag)
+{
+    /* FNV-1a over the tupel identifying the datagram */
+    const uint8_t *addr = src;
+    uint32_t hash = 2166136261U;
+
+    for (size_t i = 0; i < src_len; i++) {
+        hash = (hash ^ addr[i]) * 16777619U;
+    }
+    addr = dst;
+    for (size_t i = 0; i < dst_len; i++) {
+        hash = (hash ^ addr[i]) * 16777619U;
+    }
+    hash = (hash ^ (size >> 8)) * 16777619U;
+    hash = (hash ^ (size & 0xff)) * 16777619U;
+    hash = (hash ^ (tag >> 8)) * 16777619U;
+    hash = (hash ^ (tag & 0xff)) * 16777619U;
+
+    return &rbuf_index[hash % RBUF_BUCKETS];
+}
+
 static void _rbuf_rem(rbuf_t *entry)
 {
+    rbuf_t **bucket = &rbuf_index[entry->bucket];
+
     while (entry->ints != NULL) {
         rbuf_int_t *next = entry->ints->next;
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+        gnrc_pktbuf_release(entry->ints->frag);
+        entry->ints->frag = NULL;
+        entry->ints->data = NULL;
+#endif
         entry->ints->start = 0;
         entry->ints->end = 0;
         entry->ints->next = NULL;
         entry->ints = next;
     }
 
+    /* take the entry out of the index */
+    while (*bucket != NULL) {
+        if (*bucket == entry) {
+            *bucket = entry->next;
+            break;
+        }
+        bucket = &(*bucket)->next;
+    }
+    entry->next = NULL;
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+    if (entry->hdr != NULL) {
+        gnrc_pktbuf_release(entry->hdr);
+        entry->hdr = NULL;
+    }
+    entry->size = 0;
+#else
     entry->pkt = NULL;
+#endif
 }
 
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
+static void _rbuf_drop(rbuf_t *entry)
+{
+#ifndef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+    /* the fragments in the chained variant are released by _rbuf_rem() */
+    gnrc_pktbuf_release(entry->pkt);
+#endif
+    _rbuf_rem(entry);
+}
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+static gnrc_pktsnip_t *_rbuf_linearize(rbuf_t *entry)
+{
+    gnrc_pktsnip_t *datagram = gnrc_pktbuf_add(NULL, NULL, entry->size,
+                                               GNRC_NETTYPE_IPV6);
+    size_t hdr_len = 0;
+
+    if (datagram == NULL) {
+        return NULL;
+    }
+    if (entry->hdr != NULL) {
+        hdr_len = entry->hdr->size;
+        memcpy(datagram->data, entry->hdr->data, hdr_len);
+    }
+    for (rbuf_int_t *ptr = entry->ints; ptr != NULL; ptr = ptr->next) {
+        /* the decompressed headers precede the data of the first fragment */
+        size_t start = (ptr->start == 0) ? hdr_len : ptr->start;
+
+        memcpy(((uint8_t *)datagram->data) + start, ptr->data,
+               ptr->end + 1 - start);
+    }
+
+    return datagram;
+}
+#endif
+
+static rbuf_int_t *_rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
 {
     rbuf_int_t *new;
     uint16_t end = (uint16_t)(offset + frag_size - 1);
@@ -230,7 +410,7 @@ static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
 
     if (new == NULL) {
         DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
-        return false;
+        return NULL;
     }
 
     new->start = offset;
@@ -241,11 +421,11 @@ static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
                   sizeof(l2addr_str), entry->src, entry->src_len));
     DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(l2addr_str,
             sizeof(l2addr_str), entry->dst, entry->dst_len),
-          (unsigned)entry->pkt->size, entry->tag);
+          (unsigned)_rbuf_size(entry), entry->tag);
 
     LL_PREPEND(entry->ints, new);
 
-    return true;
+    return new;
 }
 
 static void _rbuf_gc(void)
@@ -255,17 +435,16 @@ static void _rbuf_gc(void)
 
     for (i = 0; i < RBUF_SIZE; i++) {
         /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if ((rbuf[i].pkt != NULL) &&
+        if (_rbuf_used(&rbuf[i]) &&
               ((now_usec - rbuf[i].arrival) > RBUF_TIMEOUT)) {
             DEBUG("6lo rfrag: entry (%s, ", gnrc_netif_addr_to_str(l2addr_str,
                     sizeof(l2addr_str), rbuf[i].src, rbuf[i].src_len));
             DEBUG("%s, %u, %u) timed out\n",
                   gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), rbuf[i].dst,
                                          rbuf[i].dst_len),
-                  (unsigned)rbuf[i].pkt->size, rbuf[i].tag);
+                  (unsigned)_rbuf_size(&rbuf[i]), rbuf[i].tag);
 
-            gnrc_pktbuf_release(rbuf[i].pkt);
-            _rbuf_rem(&(rbuf[i]));
+            _rbuf_drop(&(rbuf[i]));
         }
     }
 }
@@ -275,28 +454,30 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
                          size_t size, uint16_t tag)
 {
     rbuf_t *res = NULL, *oldest = NULL;
+    rbuf_t **bucket = _rbuf_bucket(src, src_len, dst, dst_len, size, tag);
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].pkt->size == size) &&
-            (rbuf[i].tag == tag) && (rbuf[i].src_len == src_len) &&
-            (rbuf[i].dst_len == dst_len) &&
-            (memcmp(rbuf[i].src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
+    /* check first if entry already available */
+    for (res = *bucket; res != NULL; res = res->next) {
+        if ((_rbuf_size(res) == size) && (res->tag == tag) &&
+            (res->src_len == src_len) && (res->dst_len == dst_len) &&
+            (memcmp(res->src, src, src_len) == 0) &&
+            (memcmp(res->dst, dst, dst_len) == 0)) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
                   gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str),
-                                         rbuf[i].src, rbuf[i].src_len));
+                                         res->src, res->src_len));
             DEBUG("%s, %u, %u) found\n",
                   gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str),
-                                         rbuf[i].dst, rbuf[i].dst_len),
-                  (unsigned)rbuf[i].pkt->size, rbuf[i].tag);
-            rbuf[i].arrival = now_usec;
-            return &(rbuf[i]);
+                                         res->dst, res->dst_len),
+                  (unsigned)_rbuf_size(res), res->tag);
+            res->arrival = now_usec;
+            return res;
         }
+    }
 
+    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
-        if ((res == NULL) && (rbuf[i].pkt == NULL)) {
+        if ((res == NULL) && !_rbuf_used(&rbuf[i])) {
             res = &(rbuf[i]);
         }
 
@@ -310,15 +491,19 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
     /* entry not in buffer and no empty spot found */
     if (res == NULL) {
         assert(oldest != NULL);
-        assert(oldest->pkt != NULL); /* if oldest->pkt == NULL, res must not be NULL */
+        /* if oldest is unused, res must not be NULL */
+        assert(_rbuf_used(oldest));
         DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
-        gnrc_pktbuf_release(oldest->pkt);
-        _rbuf_rem(oldest);
+        _rbuf_drop(oldest);
         res = oldest;
     }
 
     /* now we have an empty spot */
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+    /* nothing to allocate, the fragments are kept as they arrive */
+    res->size = size;
+#else
     res->pkt = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_IPV6);
     if (res->pkt == NULL) {
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
@@ -327,6 +512,7 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
 
     *((uint64_t *)res->pkt->data) = 0;  /* clean first few bytes for later
                                          * look-ups */
+#endif
     res->arrival = now_usec;
     memcpy(res->src, src, src_len);
     memcpy(res->dst, dst, dst_len);
@@ -334,13 +520,16 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
     res->dst_len = dst_len;
     res->tag = tag;
     res->cur_size = 0;
+    res->bucket = bucket - rbuf_index;
+    res->next = *bucket;
+    *bucket = res;
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), res->src,
                                  res->src_len));
     DEBUG("%s, %u, %u) created\n",
           gnrc_netif_addr_to_str(l2addr_str, sizeof(l2addr_str), res->dst,
-                                 res->dst_len), (unsigned)res->pkt->size,
+                                 res->dst_len), (unsigned)_rbuf_size(res),
           res->tag);
 
     return res;
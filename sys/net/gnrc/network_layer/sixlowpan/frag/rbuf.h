@@ -34,6 +34,19 @@ extern "C" {
 #define RBUF_SIZE           (4U)               /**< size of the reassembly buffer */
 #define RBUF_TIMEOUT        (3U * SEC_IN_USEC) /**< timeout for reassembly in microseconds */
 
+/**
+ * @brief   Number of buckets in the index of the reassembly buffer
+ *
+ * At most 256, as an entry keeps its bucket in a uint8_t.
+ */
+#ifndef RBUF_BUCKETS
+#define RBUF_BUCKETS        (RBUF_SIZE)
+#endif
+
+#if RBUF_BUCKETS > 256
+#error "RBUF_BUCKETS must not exceed the uint8_t bucket of rbuf_t"
+#endif
+
 /**
  * @brief   Fragment intervals to identify limits of fragments.
  *
@@ -48,6 +61,10 @@ extern "C" {
  */
 typedef struct rbuf_int {
     struct rbuf_int *next;  /**< next element in interval list */
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN) || defined(DOXYGEN)
+    gnrc_pktsnip_t *frag;   /**< the received fragment holding the interval */
+    const uint8_t *data;    /**< the interval's data within rbuf_int_t::frag */
+#endif
     uint16_t start;         /**< start byte of interval */
     uint16_t end;           /**< end byte of interval */
 } rbuf_int_t;
@@ -62,7 +79,14 @@ typedef struct rbuf_int {
  * 3. the datagram size (gnrc_pktsnip_t::size of rbuf_t::pkt), and
  * 4. the datagram tag
  *
- * to identify all fragments that belong to the given datagram.
+ * to identify all fragments that belong to the given datagram. Entries are
+ * indexed by a hash of these four values.
+ *
+ * With the `gnrc_sixlowpan_frag_chain` module, the fragments are not copied
+ * into a datagram allocated on arrival of the first one. The entry holds the
+ * received fragments in its intervals instead and the datagram is only put
+ * together once it is complete, since the upper layers expect it in one
+ * piece.
  *
  * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
  *          RFC 4944, section 5.3
@@ -70,9 +94,17 @@ typedef struct rbuf_int {
  *
  * @internal
  */
-typedef struct {
+typedef struct rbuf {
+    struct rbuf *next;                  /**< next entry in the same bucket */
     rbuf_int_t *ints;                   /**< intervals of the fragment */
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN) || defined(DOXYGEN)
+    gnrc_pktsnip_t *hdr;                /**< headers decompressed from the first
+                                         *   fragment */
+    uint16_t size;                      /**< the datagram's size, 0 if the
+                                         *   entry is unused */
+#else
     gnrc_pktsnip_t *pkt;                /**< the reassembled packet in packet buffer */
+#endif
     uint32_t arrival;                   /**< time in microseconds of arrival of
                                          *   last received fragment */
     uint8_t src[RBUF_L2ADDR_MAX_LEN];   /**< source address */
@@ -81,6 +113,7 @@ typedef struct {
     uint8_t dst_len;                    /**< length of destination address */
     uint16_t tag;                       /**< the datagram's tag */
     uint16_t cur_size;                  /**< the datagram's current size */
+    uint8_t bucket;                     /**< the entry's bucket in the index */
 } rbuf_t;
 
 /**
@@ -34,7 +34,7 @@
 
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG) && !defined(MODULE_GNRC_SIXLOWPAN_FRAG_PIPELINE)
 static gnrc_sixlowpan_msg_frag_t fragment_msg = {KERNEL_PID_UNDEF, NULL, 0, 0};
 #endif
 
@@ -272,6 +272,18 @@ static void _send(gnrc_pktsnip_t *pkt)
         return;
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_PIPELINE
+    else if (datagram_size <= SIXLOWPAN_FRAG_MAX_LEN) {
+        /* all fragments are sent right away, so there is no state to share
+         * with other datagrams */
+        gnrc_sixlowpan_msg_frag_t fragment_msg = { hdr->if_pid, pkt2,
+                                                   datagram_size, 0 };
+
+        DEBUG("6lo: Send pipelined fragments (%u > %" PRIu16 ")\n",
+              (unsigned int)datagram_size, iface->max_frag_size);
+        gnrc_sixlowpan_frag_send(&fragment_msg);
+    }
+#else
     else if (fragment_msg.pkt != NULL) {
         DEBUG("6lo: Fragmentation already ongoing. Dropping packet\n");
         gnrc_pktbuf_release(pkt2);
@@ -294,6 +306,7 @@ static void _send(gnrc_pktsnip_t *pkt)
         /* send message to self */
         msg_send_to_self(&msg);
     }
+#endif
     else {
         DEBUG("6lo: packet too big (%u > %" PRIu16 ")\n",
               (unsigned int)datagram_size, (uint16_t)SIXLOWPAN_FRAG_MAX_LEN);
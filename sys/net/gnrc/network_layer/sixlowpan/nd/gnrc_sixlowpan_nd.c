@@ -355,6 +355,9 @@ uint8_t gnrc_sixlowpan_nd_opt_ar_handle(kernel_pid_t iface, ipv6_hdr_t *ipv6,
                 }
                 nc_entry->flags &= ~GNRC_IPV6_NC_TYPE_MASK;
                 nc_entry->flags |= GNRC_IPV6_NC_TYPE_REGISTERED;
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+                gnrc_ipv6_dst_cache_flush();
+#endif
                 reg_ltime = byteorder_ntohs(ar_opt->ltime);
                 /* TODO: notify routing protocol */
                 xtimer_set_msg(&nc_entry->type_timeout, (reg_ltime * 60 * SEC_IN_USEC),
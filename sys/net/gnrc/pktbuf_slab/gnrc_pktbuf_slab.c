@@ -0,0 +1,623 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf_slab
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "mutex.h"
+#include "utlist.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/pktbuf_slab.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define _ALIGNMENT_MASK     (sizeof(void *) - 1)
+#define _ALIGN(size)        (((size) + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK))
+
+#define _SMALL_SIZE         _ALIGN(GNRC_PKTBUF_SLAB_SMALL_SIZE)
+#define _MEDIUM_SIZE        _ALIGN(GNRC_PKTBUF_SLAB_MEDIUM_SIZE)
+#define _LARGE_SIZE         _ALIGN(GNRC_PKTBUF_SLAB_LARGE_SIZE)
+
+#define _CLASS_NUMOF        (3U)
+
+/**
+ * @brief   Header of a free data slot
+ */
+typedef struct _free_slot {
+    struct _free_slot *next;
+} _free_slot_t;
+
+/**
+ * @brief   Data slot size class
+ */
+typedef struct {
+    uint8_t *pool;          /**< first slot of the class */
+    uint8_t *users;         /**< number of snips referencing each slot */
+    _free_slot_t *free;     /**< free list of the class */
+    uint16_t size;          /**< size of one slot */
+    uint16_t numof;         /**< number of slots */
+    uint16_t avail;         /**< number of free slots */
+#ifdef DEVELHELP
+    uint16_t min_avail;     /**< lowest number of free slots ever seen */
+#endif
+} _class_t;
+
+static mutex_t _mutex = MUTEX_INIT;
+
+static gnrc_pktsnip_t _snips[GNRC_PKTBUF_SLAB_SNIP_NUMOF];
+static gnrc_pktsnip_t *_free_snips;
+static unsigned _snips_avail;
+
+static uint8_t _small[GNRC_PKTBUF_SLAB_SMALL_NUMOF * _SMALL_SIZE]
+    __attribute__((aligned(sizeof(void *))));
+static uint8_t _medium[GNRC_PKTBUF_SLAB_MEDIUM_NUMOF * _MEDIUM_SIZE]
+    __attribute__((aligned(sizeof(void *))));
+static uint8_t _large[GNRC_PKTBUF_SLAB_LARGE_NUMOF * _LARGE_SIZE]
+    __attribute__((aligned(sizeof(void *))));
+static uint8_t _small_users[GNRC_PKTBUF_SLAB_SMALL_NUMOF];
+static uint8_t _medium_users[GNRC_PKTBUF_SLAB_MEDIUM_NUMOF];
+static uint8_t _large_users[GNRC_PKTBUF_SLAB_LARGE_NUMOF];
+
+/* ordered by slot size so the first matching class is the best fit */
+static _class_t _classes[_CLASS_NUMOF] = {
+    { .pool = _small, .users = _small_users,
+      .size = _SMALL_SIZE, .numof = GNRC_PKTBUF_SLAB_SMALL_NUMOF },
+    { .pool = _medium, .users = _medium_users,
+      .size = _MEDIUM_SIZE, .numof = GNRC_PKTBUF_SLAB_MEDIUM_NUMOF },
+    { .pool = _large, .users = _large_users,
+      .size = _LARGE_SIZE, .numof = GNRC_PKTBUF_SLAB_LARGE_NUMOF },
+};
+
+#ifdef DEVELHELP
+static unsigned _snips_min_avail;
+#endif
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err);
+
+static inline bool _snip_contains(void *ptr)
+{
+    return (unsigned)((uint8_t *)ptr - (uint8_t *)_snips) < sizeof(_snips);
+}
+
+static inline bool _class_contains(const _class_t *class, void *ptr)
+{
+    return (unsigned)((uint8_t *)ptr - class->pool) < (class->numof * class->size);
+}
+
+/* finds class and slot number of a data pointer, returns NULL if ptr is not
+ * in any data pool */
+static _class_t *_find_slot(void *ptr, unsigned *idx)
+{
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _class_t *class = &_classes[i];
+
+        if (_class_contains(class, ptr)) {
+            *idx = ((uint8_t *)ptr - class->pool) / class->size;
+            return class;
+        }
+    }
+    return NULL;
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    pkt->csum = 0;
+#endif
+}
+
+static gnrc_pktsnip_t *_snip_alloc(void)
+{
+    gnrc_pktsnip_t *pkt = _free_snips;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: no packet snip left\n");
+        return NULL;
+    }
+    _free_snips = pkt->next;
+    _snips_avail--;
+#ifdef DEVELHELP
+    if (_snips_avail < _snips_min_avail) {
+        _snips_min_avail = _snips_avail;
+    }
+#endif
+    return pkt;
+}
+
+static void _snip_free(gnrc_pktsnip_t *pkt)
+{
+    assert(_snip_contains(pkt));
+    pkt->next = _free_snips;
+    _free_snips = pkt;
+    _snips_avail++;
+}
+
+static void *_data_alloc(size_t size)
+{
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _class_t *class = &_classes[i];
+        _free_slot_t *slot = class->free;
+
+        /* fall through to the next larger class if this one is exhausted */
+        if ((size > class->size) || (slot == NULL)) {
+            continue;
+        }
+        class->free = slot->next;
+        class->avail--;
+        class->users[((uint8_t *)slot - class->pool) / class->size] = 1;
+#ifdef DEVELHELP
+        if (class->avail < class->min_avail) {
+            class->min_avail = class->avail;
+        }
+#endif
+        return slot;
+    }
+    DEBUG("pktbuf: no slot left for %u byte\n", (unsigned)size);
+    return NULL;
+}
+
+static void _data_free(void *data)
+{
+    unsigned idx;
+    _class_t *class = _find_slot(data, &idx);
+
+    if (class == NULL) {
+        return;
+    }
+    assert(class->users[idx] > 0);
+    if (--class->users[idx] == 0) {
+        _free_slot_t *slot = (_free_slot_t *)(class->pool + (idx * class->size));
+
+        slot->next = class->free;
+        class->free = slot;
+        class->avail++;
+    }
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    _free_snips = NULL;
+    for (unsigned i = GNRC_PKTBUF_SLAB_SNIP_NUMOF; i > 0; i--) {
+        _snips[i - 1].next = _free_snips;
+        _free_snips = &_snips[i - 1];
+    }
+    _snips_avail = GNRC_PKTBUF_SLAB_SNIP_NUMOF;
+#ifdef DEVELHELP
+    _snips_min_avail = _snips_avail;
+#endif
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _class_t *class = &_classes[i];
+
+        class->free = NULL;
+        for (unsigned j = class->numof; j > 0; j--) {
+            _free_slot_t *slot = (_free_slot_t *)(class->pool + ((j - 1) * class->size));
+
+            slot->next = class->free;
+            class->free = slot;
+            class->users[j - 1] = 0;
+        }
+        class->avail = class->numof;
+#ifdef DEVELHELP
+        class->min_avail = class->avail;
+#endif
+    }
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _LARGE_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              (unsigned)size, (unsigned)_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    unsigned idx;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _snip_alloc();
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    _set_pktsnip(marked_snip, pkt->next, pkt->data, size, type);
+    if (pkt->size != size) {
+        _class_t *class = _find_slot(pkt->data, &idx);
+
+        /* both snips now point into the same slot */
+        if (class != NULL) {
+            assert(class->users[idx] < UINT8_MAX);
+            class->users[idx]++;
+        }
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    pkt->csum = 0;
+#endif
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    _class_t *class = NULL;
+    unsigned idx = 0;
+
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    if (pkt->data != NULL) {
+        class = _find_slot(pkt->data, &idx);
+    }
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && (class != NULL)));
+    /* new size and old size are equal or data just shrinks */
+    if ((size <= pkt->size) && (size > 0)) {
+        pkt->size = size;
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+        pkt->csum = 0;
+#endif
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if (size == 0) {
+        _data_free(pkt->data);
+        pkt->data = NULL;
+    }
+    /* slot is not shared and has room left behind the data */
+    else if ((class != NULL) && (class->users[idx] == 1) &&
+             (((uint8_t *)pkt->data - (class->pool + (idx * class->size))) + size)
+             <= class->size) {
+        /* grow in place */
+    }
+    else {
+        void *new_data;
+
+        if ((size > _LARGE_SIZE) || ((new_data = _data_alloc(size)) == NULL)) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, pkt->size);
+            _data_free(pkt->data);
+        }
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    pkt->csum = 0;
+#endif
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_snip_contains(pkt));
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _data_free(pkt->data);
+            _snip_free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if ((pkt == NULL) || (pkt->size == 0)) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_get_iovec(gnrc_pktsnip_t *pkt, size_t *len)
+{
+    size_t length;
+    gnrc_pktsnip_t *head;
+    struct iovec *vec;
+
+    assert(len != NULL);
+    if (pkt == NULL) {
+        *len = 0;
+        return NULL;
+    }
+
+    /* count the number of snips in the packet and allocate the IOVEC */
+    length = gnrc_pkt_count(pkt);
+    head = gnrc_pktbuf_add(pkt, NULL, (length * sizeof(struct iovec)),
+                           GNRC_NETTYPE_IOVEC);
+    if (head == NULL) {
+        *len = 0;
+        return NULL;
+    }
+
+    assert(head->data != NULL);
+    vec = (struct iovec *)(head->data);
+    /* fill the IOVEC */
+    while (pkt != NULL) {
+        vec->iov_base = pkt->data;
+        vec->iov_len = pkt->size;
+        ++vec;
+        pkt = pkt->next;
+    }
+    *len = length;
+    return head;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[_CLASS_NUMOF] = { "small", "medium", "large" };
+
+    printf("packet buffer: snips: %u/%u free (min. %u)\n", _snips_avail,
+           GNRC_PKTBUF_SLAB_SNIP_NUMOF, _snips_min_avail);
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _class_t *class = &_classes[i];
+
+        printf("  %-6s (%4u byte): %u/%u free (min. %u)\n", names[i],
+               (unsigned)class->size, (unsigned)class->avail,
+               (unsigned)class->numof, (unsigned)class->min_avail);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    if (_snips_avail != GNRC_PKTBUF_SLAB_SNIP_NUMOF) {
+        return false;
+    }
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        if (_classes[i].avail != _classes[i].numof) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    unsigned count = 0;
+
+    /* Invariants of this implementation:
+     *  - every element of a free list is slot-aligned within its pool
+     *  - free slots are not referenced by any snip
+     *  - the length of every free list equals its available counter
+     */
+    for (gnrc_pktsnip_t *ptr = _free_snips; ptr != NULL; ptr = ptr->next) {
+        if (!_snip_contains(ptr) || (++count > GNRC_PKTBUF_SLAB_SNIP_NUMOF)) {
+            return false;
+        }
+    }
+    if (count != _snips_avail) {
+        return false;
+    }
+    for (unsigned i = 0; i < _CLASS_NUMOF; i++) {
+        _class_t *class = &_classes[i];
+
+        count = 0;
+        for (_free_slot_t *ptr = class->free; ptr != NULL; ptr = ptr->next) {
+            unsigned offset = (uint8_t *)ptr - class->pool;
+
+            if (!_class_contains(class, ptr) || ((offset % class->size) != 0) ||
+                (class->users[offset / class->size] != 0) ||
+                (++count > class->numof)) {
+                return false;
+            }
+        }
+        if (count != class->avail) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _snip_alloc();
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _data_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _snip_free(pkt);
+            return NULL;
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    if (data != NULL) {
+        memcpy(_data, data, size);
+    }
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_remove_snip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *snip)
+{
+    LL_DELETE(pkt, snip);
+    snip->next = NULL;
+    gnrc_pktbuf_release(snip);
+
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_replace_snip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *old, gnrc_pktsnip_t *add)
+{
+    /* If add is a list we need to preserve its tail */
+    if (add->next != NULL) {
+        gnrc_pktsnip_t *tail = add->next;
+        gnrc_pktsnip_t *back;
+        LL_SEARCH_SCALAR(tail, back, next, NULL); /* find the last snip in add */
+        /* Replace old */
+        LL_REPLACE_ELEM(pkt, old, add);
+        /* and wire in the tail between */
+        back->next = add->next;
+        add->next = tail;
+    }
+    else {
+        /* add is a single element, has no tail, simply replace */
+        LL_REPLACE_ELEM(pkt, old, add);
+    }
+    old->next = NULL;
+    gnrc_pktbuf_release(old);
+
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
+{
+    mutex_lock(&_mutex);
+
+    bool is_shared = pkt->users > 1;
+    size_t size = gnrc_pkt_len_upto(pkt, type);
+
+    DEBUG("pktbuf: duplicating %d octets\n", (int) size);
+
+    gnrc_pktsnip_t *tmp;
+    gnrc_pktsnip_t *target = gnrc_pktsnip_search_type(pkt, type);
+    gnrc_pktsnip_t *next = (target == NULL) ? NULL : target->next;
+    gnrc_pktsnip_t *new = (size > _LARGE_SIZE) ? NULL :
+                          _create_snip(next, NULL, size, type);
+
+    if (new == NULL) {
+        mutex_unlock(&_mutex);
+
+        return NULL;
+    }
+
+    /* copy payloads */
+    for (tmp = pkt; tmp != NULL; tmp = tmp->next) {
+        uint8_t *dest = ((uint8_t *)new->data) + (size - tmp->size);
+
+        memcpy(dest, tmp->data, tmp->size);
+
+        size -= tmp->size;
+
+        if (tmp->type == type) {
+            break;
+        }
+    }
+
+    /* decrements reference counters */
+
+    if (target != NULL) {
+        target->next = NULL;
+    }
+
+    _release_error_locked(pkt, GNRC_NETERR_SUCCESS);
+
+    if (is_shared && (target != NULL)) {
+        target->next = next;
+    }
+
+    mutex_unlock(&_mutex);
+
+    return new;
+}
+
+/** @} */
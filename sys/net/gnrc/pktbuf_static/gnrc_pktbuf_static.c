@@ -78,6 +78,9 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    pkt->csum = 0;
+#endif
 }
 
 void gnrc_pktbuf_init(void)
@@ -162,6 +165,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
                                           NULL;
     }
     pkt->size -= size;
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    pkt->csum = 0;
+#endif
     _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
     pkt->next = marked_snip;
     mutex_unlock(&_mutex);
@@ -209,6 +215,9 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
                      pkt->size - aligned_size);
     }
     pkt->size = size;
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    pkt->csum = 0;
+#endif
     mutex_unlock(&_mutex);
     return 0;
 }
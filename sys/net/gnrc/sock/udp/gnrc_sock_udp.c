@@ -22,9 +22,12 @@
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/udp.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
 #include "net/sock/udp.h"
 #include "net/udp.h"
 #include "random.h"
+#include "xtimer.h"
 
 #include "gnrc_sock_internal.h"
 
@@ -115,6 +118,35 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *remote)
     return 0;
 }
 
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+/**
+ * @brief   Verifies the UDP checksum of @p pkt and copies its payload to
+ *          @p data on the way if it fits into @p max_len bytes
+ *
+ * @return  true, if the checksum is valid
+ */
+static bool _copy_verify(void *data, size_t max_len, gnrc_pktsnip_t *pkt,
+                         gnrc_pktsnip_t *udp)
+{
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    uint16_t csum;
+
+    assert(ipv6);
+    if (pkt->size <= max_len) {
+        csum = inet_csum_slice_copy(0, data, pkt->data, pkt->size, 0);
+    }
+    else {
+        csum = inet_csum_slice(0, pkt->data, pkt->size, 0);
+    }
+    /* the header starts at offset 0 of the datagram, the payload at an even
+     * offset behind it, so both are summed as if they started at 0 */
+    csum = inet_csum_slice(csum, udp->data, udp->size, 0);
+    csum = ipv6_hdr_inet_csum(csum, ipv6->data, PROTNUM_UDP,
+                              udp->size + pkt->size);
+    return (csum == 0xFFFF);
+}
+#endif
+
 ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                       uint32_t timeout, sock_udp_ep_t *remote)
 {
@@ -122,22 +154,47 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
     udp_hdr_t *hdr;
     sock_ip_ep_t tmp;
     int res;
+#if defined(MODULE_GNRC_UDP_CSUM_COPY) && defined(MODULE_XTIMER)
+    uint32_t start = xtimer_now_usec();
+#endif
 
     assert((sock != NULL) && (data != NULL) && (max_len > 0));
     if (sock->local.family == AF_UNSPEC) {
         return -EADDRNOTAVAIL;
     }
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+retry:
+#endif
     tmp.family = sock->local.family;
     res = gnrc_sock_recv((gnrc_sock_reg_t *)sock, &pkt, timeout, &tmp);
     if (res < 0) {
         return res;
     }
+    udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+    assert(udp);
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    if (!_copy_verify(data, max_len, pkt, udp)) {
+        /* drop it, just like gnrc_udp would have */
+        gnrc_pktbuf_release(pkt);
+#ifdef MODULE_XTIMER
+        if ((timeout != SOCK_NO_TIMEOUT) && (timeout != 0)) {
+            /* only wait for what is left of the timeout */
+            uint32_t now = xtimer_now_usec();
+
+            if ((now - start) >= timeout) {
+                return -ETIMEDOUT;
+            }
+            timeout -= now - start;
+            start = now;
+        }
+#endif
+        goto retry;
+    }
+#endif
     if (pkt->size > max_len) {
         gnrc_pktbuf_release(pkt);
         return -ENOBUFS;
     }
-    udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
-    assert(udp);
     hdr = udp->data;
     if (remote != NULL) {
         /* return remote to possibly block if wrong remote */
@@ -154,7 +211,10 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
         gnrc_pktbuf_release(pkt);
         return -EPROTO;
     }
+#ifndef MODULE_GNRC_UDP_CSUM_COPY
+    /* with gnrc_udp_csum_copy the payload was copied while verifying it */
     memcpy(data, pkt->data, pkt->size);
+#endif
     gnrc_pktbuf_release(pkt);
     return (int)pkt->size;
 }
@@ -265,10 +325,18 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
          * there was no remote given on create, take from local */
         rem.family = local.family;
     }
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    payload = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return -ENOMEM;
+    }
+    payload->csum = inet_csum_slice_copy(0, payload->data, data, len, 0);
+#else
     payload = gnrc_pktbuf_add(NULL, (void *)data, len, GNRC_NETTYPE_UNDEF);
     if (payload == NULL) {
         return -ENOMEM;
     }
+#endif
     pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
     if (pkt == NULL) {
         gnrc_pktbuf_release(payload);
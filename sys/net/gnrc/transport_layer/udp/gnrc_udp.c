@@ -17,6 +17,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <errno.h>
 
@@ -68,6 +69,17 @@ static uint16_t _calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr,
 
     /* process the payload */
     while (payload && payload != hdr && payload != pseudo_hdr) {
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+        if (payload->csum != 0) {
+            /* already summed up while copying into the packet buffer */
+            uint32_t sum = (len & 1) ? byteorder_swaps(payload->csum)
+                                     : payload->csum;
+
+            sum += csum;
+            csum = (uint16_t)((sum >> 16) + (sum & 0xffff));
+        }
+        else
+#endif
         csum = inet_csum_slice(csum, (uint8_t *)(payload->data), payload->size, len);
         len += (uint16_t)payload->size;
         payload = payload->next;
@@ -98,6 +110,29 @@ static uint16_t _calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr,
     }
 }
 
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+/**
+ * @brief   Checks if all receivers registered for @p port are socks
+ *
+ * sock_udp_recv() verifies the checksum while copying the payload out of the
+ * packet buffer, so it does not need to be verified beforehand for them.
+ */
+static bool _only_socks(uint32_t port)
+{
+    int numof;
+    gnrc_netreg_entry_t *entry = gnrc_netreg_lookup_num(GNRC_NETTYPE_UDP, port,
+                                                        &numof);
+
+    while (entry) {
+        if (entry->type != GNRC_NETREG_TYPE_MBOX) {
+            return false;
+        }
+        entry = gnrc_netreg_getnext(entry);
+    }
+    return (numof > 0);
+}
+#endif
+
 static void _receive(gnrc_pktsnip_t *pkt)
 {
     gnrc_pktsnip_t *udp, *ipv6;
@@ -145,15 +180,20 @@ static void _receive(gnrc_pktsnip_t *pkt)
         gnrc_pktbuf_release(pkt);
         return;
     }
+
+    /* get port (netreg demux context) */
+    port = (uint32_t)byteorder_ntohs(hdr->dst_port);
+
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    if (!_only_socks(port) && (_calc_csum(udp, ipv6, pkt) != 0xFFFF)) {
+#else
     if (_calc_csum(udp, ipv6, pkt) != 0xFFFF) {
+#endif
         DEBUG("udp: received packet with invalid checksum, dropping it\n");
         gnrc_pktbuf_release(pkt);
         return;
     }
 
-    /* get port (netreg demux context) */
-    port = (uint32_t)byteorder_ntohs(hdr->dst_port);
-
     /* send payload to receivers */
     if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP, port, pkt)) {
         DEBUG("udp: unable to forward packet as no one is interested in it\n");
@@ -19,11 +19,13 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
 #include <errno.h>
+#include "irq.h"
 #include "thread.h"
 #include "mutex.h"
 #include "msg.h"
@@ -65,6 +67,325 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * MS_IN_USEC);
 }
 
+/**
+ * @brief advances the generation of the table, see fib_get_generation()
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_changed(fib_table_t *table)
+{
+    /* the lifetime timer advances it from interrupt context, too */
+    unsigned state = irq_disable();
+
+    table->generation++;
+    irq_restore(state);
+}
+
+/**
+ * @brief lifetime timer callback, runs in interrupt context
+ *
+ * @param[in] arg   the FIB table
+ */
+static void fib_lifetime_expired(void *arg)
+{
+    ((fib_table_t *)arg)->lifetime_expired = 1;
+    /* expired entries are only removed on the next lookup, so tell users
+     * caching lookups to do one */
+    fib_changed(arg);
+}
+
+/**
+ * @brief sets the lifetime timer if the given lifetime expires before the
+ *        currently scheduled one
+ *
+ * @param[in] table     the FIB table
+ * @param[in] lifetime  the absolute lifetime of an entry in us
+ */
+static void fib_lifetime_arm(fib_table_t *table, uint64_t lifetime)
+{
+    if ((lifetime == FIB_LIFETIME_NO_EXPIRE) || (lifetime >= table->next_expiry)) {
+        return;
+    }
+
+    uint64_t now = xtimer_now_usec64();
+    uint64_t offset = (lifetime > now) ? (lifetime - now) : 0;
+
+    table->next_expiry = lifetime;
+    table->lifetime_timer.callback = fib_lifetime_expired;
+    table->lifetime_timer.arg = table;
+    /* lifetimes beyond the 32 bit range are picked up again on the next sweep */
+    xtimer_set(&table->lifetime_timer,
+               (offset > UINT32_MAX) ? UINT32_MAX : (uint32_t)offset);
+}
+
+/**
+ * @brief returns the number of significant bits of a destination
+ *
+ * @param[in] dst          the destination address
+ * @param[in] dst_size     the destination address size
+ * @param[in] dst_flags    the destination address flags
+ *
+ * @return 0 for the all zeros (default route) address,
+ *         the net prefix length given by the flags if set,
+ *         the full address length in bits otherwise
+ */
+static uint16_t fib_prefix_len(uint8_t *dst, size_t dst_size, uint32_t dst_flags)
+{
+    size_t len = dst_size << 3;
+    size_t i;
+
+    for (i = 0; (i < dst_size) && (dst[i] == 0); ++i) {}
+    if (i == dst_size) {
+        return 0;
+    }
+
+    if (dst_flags & FIB_FLAG_NET_PREFIX_MASK) {
+        size_t prefix_len = (dst_flags & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
+
+        if (prefix_len < len) {
+            len = prefix_len;
+        }
+    }
+
+    return (uint16_t)len;
+}
+
+/**
+ * @brief checks if the first @p len bits of two addresses are equal
+ */
+static inline bool fib_prefix_equal(const uint8_t *a, const uint8_t *b, size_t len)
+{
+    size_t bytes = len >> 3;
+
+    if (memcmp(a, b, bytes) != 0) {
+        return false;
+    }
+    if (len & 0x7) {
+        uint8_t mask = 0xff << (8 - (len & 0x7));
+        return ((a[bytes] ^ b[bytes]) & mask) == 0;
+    }
+    return true;
+}
+
+/**
+ * @brief returns byte @p i of an address with all bits beyond @p len cleared
+ */
+static inline uint8_t fib_masked_byte(const uint8_t *addr, size_t len, size_t i)
+{
+    if (i < (len >> 3)) {
+        return addr[i];
+    }
+    if ((i == (len >> 3)) && (len & 0x7)) {
+        return addr[i] & (0xff << (8 - (len & 0x7)));
+    }
+    return 0;
+}
+
+/**
+ * @brief compares an entry to a key in the order of the lookup index
+ *
+ * Entries are ordered by address size, masked prefix, prefix length and
+ * finally the full address. In this order every prefix precedes all prefixes
+ * and addresses it encloses.
+ *
+ * @note    The address containers are read without the universal address
+ *          lock. This is safe as a container is not altered while in use.
+ *
+ * @param[in] entry     the entry to compare
+ * @param[in] addr      the address of the key
+ * @param[in] addr_size the address size of the key
+ * @param[in] len       the prefix length of the key in bits
+ *
+ * @return < 0, 0 or > 0 if @p entry is ordered before, equal to or after the key
+ */
+static int fib_key_cmp(const fib_entry_t *entry, const uint8_t *addr,
+                       size_t addr_size, size_t len)
+{
+    const universal_address_container_t *global = entry->global;
+    size_t common = ((entry->prefix_len < len) ? entry->prefix_len : len) >> 3;
+    int ret;
+
+    if (global->address_size != addr_size) {
+        return (global->address_size < addr_size) ? -1 : 1;
+    }
+    if ((ret = memcmp(global->address, addr, common)) != 0) {
+        return ret;
+    }
+    for (size_t i = common; i < addr_size; ++i) {
+        uint8_t a = fib_masked_byte(global->address, entry->prefix_len, i);
+        uint8_t b = fib_masked_byte(addr, len, i);
+
+        if (a != b) {
+            return (a < b) ? -1 : 1;
+        }
+    }
+    if (entry->prefix_len != len) {
+        return (entry->prefix_len < len) ? -1 : 1;
+    }
+    return memcmp(global->address, addr, addr_size);
+}
+
+/**
+ * @brief checks if the prefix of @p outer encloses the prefix of @p inner
+ */
+static inline bool fib_encloses(const fib_entry_t *outer, const fib_entry_t *inner)
+{
+    return (outer->global->address_size == inner->global->address_size) &&
+           (outer->prefix_len <= inner->prefix_len) &&
+           fib_prefix_equal(outer->global->address, inner->global->address,
+                            outer->prefix_len);
+}
+
+/**
+ * @brief returns the position of the first used entry ordered after the key
+ */
+static size_t fib_upper_bound(fib_table_t *table, const uint8_t *addr,
+                              size_t addr_size, size_t len)
+{
+    size_t lo = 0;
+    size_t hi = table->used;
+
+    while (lo < hi) {
+        size_t mid = lo + ((hi - lo) >> 1);
+
+        if (fib_key_cmp(&table->data.entries[mid], addr, addr_size, len) <= 0) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief links every used entry to the nearest preceding entry enclosing it
+ *
+ * All entries enclosing entry i are ancestors of entry i-1, so walking up from
+ * the predecessor visits every entry at most once in total.
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_index_rebuild(fib_table_t *table)
+{
+    fib_entry_t *entries = table->data.entries;
+
+    for (size_t i = 0; i < table->used; ++i) {
+        uint16_t parent = (i == 0) ? FIB_ENTRY_NO_PARENT : (uint16_t)(i - 1);
+
+        while ((parent != FIB_ENTRY_NO_PARENT) &&
+               !fib_encloses(&entries[parent], &entries[i])) {
+            parent = entries[parent].parent;
+        }
+        entries[i].parent = parent;
+    }
+}
+
+/**
+ * @brief removes the given entry
+ *
+ * @note    fib_compact() must be called afterwards to update the index
+ *
+ * @param[in] entry the entry to be removed
+ *
+ * @return 0 on success
+ */
+static int fib_remove(fib_entry_t *entry)
+{
+    if (entry->global != NULL) {
+        universal_address_rem(entry->global);
+    }
+
+    if (entry->next_hop) {
+        universal_address_rem(entry->next_hop);
+    }
+
+    entry->global = NULL;
+    entry->global_flags = 0;
+    entry->next_hop = NULL;
+    entry->next_hop_flags = 0;
+
+    entry->iface_id = KERNEL_PID_UNDEF;
+    entry->lifetime = 0;
+
+    return 0;
+}
+
+/**
+ * @brief closes the gaps left by removed entries and updates the index
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_compact(fib_table_t *table)
+{
+    fib_entry_t *entries = table->data.entries;
+    size_t used = 0;
+
+    for (size_t i = 0; i < table->used; ++i) {
+        if (entries[i].global != NULL) {
+            if (used != i) {
+                entries[used] = entries[i];
+            }
+            used++;
+        }
+    }
+
+    memset(&entries[used], 0, (table->used - used) * sizeof(fib_entry_t));
+    table->used = used;
+    fib_index_rebuild(table);
+    fib_changed(table);
+}
+
+/**
+ * @brief removes all expired entries and sets the lifetime timer to the next
+ *        expiring entry
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_lifetime_sweep(fib_table_t *table)
+{
+    uint64_t now = xtimer_now_usec64();
+    uint64_t next = FIB_LIFETIME_NO_EXPIRE;
+    bool removed = false;
+
+    table->lifetime_expired = 0;
+
+    for (size_t i = 0; i < table->used; ++i) {
+        fib_entry_t *entry = &table->data.entries[i];
+
+        if (entry->lifetime == FIB_LIFETIME_NO_EXPIRE) {
+            continue;
+        }
+        if (entry->lifetime <= now) {
+            fib_remove(entry);
+            removed = true;
+        }
+        else if (entry->lifetime < next) {
+            next = entry->lifetime;
+        }
+    }
+
+    if (removed) {
+        fib_compact(table);
+    }
+
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+    fib_lifetime_arm(table, next);
+}
+
+/**
+ * @brief removes expired entries if the lifetime timer fired since the last
+ *        call
+ *
+ * @param[in] table     the FIB table
+ */
+static inline void fib_lifetime_check(fib_table_t *table)
+{
+    if (table->lifetime_expired) {
+        fib_lifetime_sweep(table);
+    }
+}
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -81,13 +402,9 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
-    uint64_t now = xtimer_now_usec64();
-
+    fib_entry_t *entries = table->data.entries;
     size_t count = 0;
-    size_t prefix_size = 0;
-    size_t match_size = dst_size << 3;
     int ret = -EHOSTUNREACH;
-    bool is_all_zeros_addr = true;
 
 #if ENABLE_DEBUG
     DEBUG("[fib_find_entry] dst =");
@@ -97,81 +414,35 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     DEBUG("\n");
 #endif
 
-    for (size_t i = 0; i < dst_size; ++i) {
-        if (dst[i] != 0) {
-            is_all_zeros_addr = false;
-            break;
-        }
-    }
-
-    for (size_t i = 0; i < table->size; ++i) {
-
-        /* autoinvalidate if the entry lifetime is not set to not expire */
-        if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
+    fib_lifetime_check(table);
 
-            /* check if the lifetime expired */
-            if (table->data.entries[i].lifetime < now) {
-                /* remove this entry if its lifetime expired */
-                table->data.entries[i].lifetime = 0;
-                table->data.entries[i].global_flags = 0;
-                table->data.entries[i].next_hop_flags = 0;
-                table->data.entries[i].iface_id = KERNEL_PID_UNDEF;
+    /* every entry matching dst encloses the last entry ordered before dst,
+     * so we walk up from there from the longest to the shortest prefix */
+    size_t pos = fib_upper_bound(table, dst, dst_size, dst_size << 3);
+    uint16_t idx = (pos == 0) ? FIB_ENTRY_NO_PARENT : (uint16_t)(pos - 1);
 
-                if (table->data.entries[i].global != NULL) {
-                    universal_address_rem(table->data.entries[i].global);
-                    table->data.entries[i].global = NULL;
-                }
+    for (; idx != FIB_ENTRY_NO_PARENT; idx = entries[idx].parent) {
+        fib_entry_t *entry = &entries[idx];
 
-                if (table->data.entries[i].next_hop != NULL) {
-                    universal_address_rem(table->data.entries[i].next_hop);
-                    table->data.entries[i].next_hop = NULL;
-                }
-            }
+        if ((entry->global->address_size != dst_size) ||
+            !fib_prefix_equal(entry->global->address, dst, entry->prefix_len)) {
+            continue;
         }
 
-        if ((prefix_size < (dst_size<<3)) && (table->data.entries[i].global != NULL)) {
+        /* If we found an exact match */
+        if (memcmp(entry->global->address, dst, dst_size) == 0) {
+            entry_arr[0] = entry;
+            *entry_arr_size = 1;
+            /* we will not find a better one so we return */
+            return 1;
+        }
 
-            int ret_comp = universal_address_compare(table->data.entries[i].global, dst, &match_size);
-            /* If we found an exact match */
-            if ((ret_comp == UNIVERSAL_ADDRESS_EQUAL)
-                || (is_all_zeros_addr && (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS))) {
-                entry_arr[0] = &(table->data.entries[i]);
-                *entry_arr_size = 1;
-                /* we will not find a better one so we return */
-                return 1;
-            }
-            else {
-                /* we try to find the most fitting prefix */
-                if (ret_comp == UNIVERSAL_ADDRESS_MATCHING_PREFIX) {
-                    if (table->data.entries[i].global_flags & FIB_FLAG_NET_PREFIX_MASK) {
-                        /* we shift the most upper flag byte back to get the number of prefix bits */
-                        size_t global_prefix_len = (table->data.entries[i].global_flags
-                                                    & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
-
-                        if ((match_size >= global_prefix_len) &&
-                            ((prefix_size == 0) || (match_size > prefix_size))) {
-                            entry_arr[0] = &(table->data.entries[i]);
-                            /* we could find a better one so we move on */
-                            ret = 0;
-
-                            prefix_size = match_size;
-                            count = 1;
-                        }
-                    }
-                 }
-                 else if (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS) {
-                    /* we found the default gateway entry, e.g. ::/0 for IPv6
-                     * and we keep it only if there is no better one
-                     */
-                    if (prefix_size == 0) {
-                        entry_arr[0] = &(table->data.entries[i]);
-                        /* we could find a better one so we move on */
-                        ret = 0;
-                        count = 1;
-                    }
-                }
-                match_size = dst_size<<3;
-            }
+        /* the first matching prefix is the longest one, but we keep looking
+         * for an exact match */
+        if (count == 0) {
+            entry_arr[0] = entry;
+            ret = 0;
+            count = 1;
         }
     }
 
@@ -192,6 +463,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table the entry belongs to
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -201,7 +473,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry, uint8_t *next_hop,
                          size_t next_hop_size, uint32_t next_hop_flags,
                          uint32_t lifetime)
 {
@@ -217,11 +489,13 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
 
     if (lifetime != (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
         fib_lifetime_to_absolute(lifetime, &entry->lifetime);
+        fib_lifetime_arm(table, entry->lifetime);
     }
     else {
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
     }
 
+    fib_changed(table);
     return 0;
 }
 
@@ -246,60 +520,45 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                             uint8_t *next_hop, size_t next_hop_size, uint32_t
                             next_hop_flags, uint32_t lifetime)
 {
-    for (size_t i = 0; i < table->size; ++i) {
-        if (table->data.entries[i].lifetime == 0) {
+    universal_address_container_t *global, *next;
 
-            table->data.entries[i].global = universal_address_add(dst, dst_size);
+    if (table->used >= table->size) {
+        return -ENOMEM;
+    }
 
-            if (table->data.entries[i].global != NULL) {
-                table->data.entries[i].global_flags = dst_flags;
-                table->data.entries[i].next_hop = universal_address_add(next_hop, next_hop_size);
-                table->data.entries[i].next_hop_flags = next_hop_flags;
-            }
+    if ((global = universal_address_add(dst, dst_size)) == NULL) {
+        return -ENOMEM;
+    }
 
-            if (table->data.entries[i].next_hop != NULL) {
-                /* everything worked fine */
-                table->data.entries[i].iface_id = iface_id;
+    if ((next = universal_address_add(next_hop, next_hop_size)) == NULL) {
+        universal_address_rem(global);
+        return -ENOMEM;
+    }
 
-                if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
-                    fib_lifetime_to_absolute(lifetime, &table->data.entries[i].lifetime);
-                }
-                else {
-                    table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
-                }
+    uint16_t prefix_len = fib_prefix_len(dst, dst_size, dst_flags);
+    size_t pos = fib_upper_bound(table, dst, dst_size, prefix_len);
+    fib_entry_t *entry = &table->data.entries[pos];
 
-                return 0;
-            }
-        }
-    }
+    memmove(entry + 1, entry, (table->used - pos) * sizeof(fib_entry_t));
+    table->used++;
 
-    return -ENOMEM;
-}
+    entry->iface_id = iface_id;
+    entry->prefix_len = prefix_len;
+    entry->global = global;
+    entry->global_flags = dst_flags;
+    entry->next_hop = next;
+    entry->next_hop_flags = next_hop_flags;
 
-/**
- * @brief removes the given entry
- *
- * @param[in] entry the entry to be removed
- *
- * @return 0 on success
- */
-static int fib_remove(fib_entry_t *entry)
-{
-    if (entry->global != NULL) {
-        universal_address_rem(entry->global);
+    if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
+        fib_lifetime_to_absolute(lifetime, &entry->lifetime);
     }
-
-    if (entry->next_hop) {
-        universal_address_rem(entry->next_hop);
+    else {
+        entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
     }
 
-    entry->global = NULL;
-    entry->global_flags = 0;
-    entry->next_hop = NULL;
-    entry->next_hop_flags = 0;
-
-    entry->iface_id = KERNEL_PID_UNDEF;
-    entry->lifetime = 0;
+    fib_index_rebuild(table);
+    fib_lifetime_arm(table, entry->lifetime);
+    fib_changed(table);
 
     return 0;
 }
@@ -403,7 +662,7 @@ int fib_add_entry(fib_table_t *table,
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -433,7 +692,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -458,6 +717,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
     if (ret == 1) {
         /* we must take the according entry and update the values */
         fib_remove(entry[0]);
+        fib_compact(table);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -474,12 +734,13 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     mutex_lock(&(table->mtx_access));
     DEBUG("[fib_flush]\n");
 
-    for (size_t i = 0; i < table->size; ++i) {
+    for (size_t i = 0; i < table->used; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
             fib_remove(&table->data.entries[i]);
         }
     }
+    fib_compact(table);
 
     mutex_unlock(&(table->mtx_access));
 }
@@ -547,7 +808,9 @@ int fib_get_destination_set(fib_table_t *table, uint8_t *prefix,
     int ret = -EHOSTUNREACH;
     size_t found_entries = 0;
 
-    for (size_t i = 0; i < table->size; ++i) {
+    fib_lifetime_check(table);
+
+    for (size_t i = 0; i < table->used; ++i) {
         if ((table->data.entries[i].global != NULL) &&
             (universal_address_compare_prefix(table->data.entries[i].global, prefix, prefix_size<<3) >= UNIVERSAL_ADDRESS_EQUAL)) {
             if( (dst_set != NULL) && (found_entries < *dst_set_size) ) {
@@ -578,6 +841,7 @@ int fib_get_destination_set(fib_table_t *table, uint8_t *prefix,
 void fib_init(fib_table_t *table)
 {
     DEBUG("[fib_init] hello. Initializing some stuff.\n");
+    assert(table->size < FIB_ENTRY_NO_PARENT);
     mutex_init(&(table->mtx_access));
     mutex_lock(&(table->mtx_access));
 
@@ -588,6 +852,11 @@ void fib_init(fib_table_t *table)
 
     table->notify_rp_pos = 0;
 
+    xtimer_remove(&table->lifetime_timer);
+    table->used = 0;
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+    table->lifetime_expired = 0;
+
     if (table->table_type == FIB_TABLE_TYPE_SR) {
         memset(table->data.source_routes->headers, 0,
                sizeof(fib_sr_t) * table->size);
@@ -613,6 +882,11 @@ void fib_deinit(fib_table_t *table)
 
     table->notify_rp_pos = 0;
 
+    xtimer_remove(&table->lifetime_timer);
+    table->used = 0;
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+    table->lifetime_expired = 0;
+
     if (table->table_type == FIB_TABLE_TYPE_SR) {
         memset(table->data.source_routes->headers, 0,
                sizeof(fib_sr_t) * table->size);
@@ -622,6 +896,7 @@ void fib_deinit(fib_table_t *table)
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
+    fib_changed(table);
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
 }
@@ -655,16 +930,17 @@ int fib_register_rp(fib_table_t *table, uint8_t *prefix, size_t prefix_addr_type
 int fib_get_num_used_entries(fib_table_t *table)
 {
     mutex_lock(&(table->mtx_access));
-    size_t used_entries = 0;
-
-    for (size_t i = 0; i < table->size; ++i) {
-        used_entries += (size_t)(table->data.entries[i].global != NULL);
-    }
-
+    fib_lifetime_check(table);
+    size_t used_entries = table->used;
     mutex_unlock(&(table->mtx_access));
     return used_entries;
 }
 
+unsigned fib_get_generation(fib_table_t *table)
+{
+    return table->generation;
+}
+
 /* source route handling */
 int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_id,
                   uint32_t sr_flags, uint32_t sr_lifetime)
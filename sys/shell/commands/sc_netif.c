@@ -276,15 +276,62 @@ static void _print_netopt_state(netopt_state_t state)
     }
 }
 
+/**
+ * @brief   Indices of the options requested by _netif_list()
+ */
+enum {
+    _LIST_ADDRESS = 0,
+    _LIST_CHANNEL,
+    _LIST_CHANNEL_PAGE,
+    _LIST_NID,
+    _LIST_ADDRESS_LONG,
+    _LIST_TX_POWER,
+    _LIST_STATE,
+    _LIST_RETRANS,
+    _LIST_CSMA_RETRIES,
+    _LIST_SRC_LEN,
+    _LIST_FLAGS,            /**< first of the flags in _list_flags */
+};
+
+/**
+ * @brief   Flags printed by _netif_list() if enabled
+ */
+static const struct {
+    netopt_t opt;
+    const char *name;
+} _list_flags[] = {
+    { NETOPT_PROMISCUOUSMODE, "PROMISC" },
+    { NETOPT_AUTOACK, "AUTOACK" },
+    { NETOPT_ACK_REQ, "ACK_REQ" },
+    { NETOPT_PRELOADING, "PRELOAD" },
+    { NETOPT_RAWMODE, "RAWMODE" },
+    { NETOPT_CSMA, "CSMA" },
+    { NETOPT_AUTOCCA, "AUTOCCA" },
+};
+
+#define _LIST_FLAGS_NUMOF   (sizeof(_list_flags) / sizeof(_list_flags[0]))
+#define _LIST_CSMA_FLAG     (5U)    /**< index of NETOPT_CSMA in _list_flags */
+
+static void _get_req(gnrc_netapi_opt_req_t *req, netopt_t opt, void *data,
+                     size_t data_len)
+{
+    req->type = GNRC_NETAPI_MSG_TYPE_GET;
+    req->opt.opt = opt;
+    req->opt.context = 0;
+    req->opt.data = data;
+    req->opt.data_len = data_len;
+}
+
 static void _netif_list(kernel_pid_t dev)
 {
-    uint8_t hwaddr[MAX_ADDR_LEN];
-    uint16_t u16;
-    int16_t i16;
-    uint8_t u8;
+    uint8_t hwaddr[MAX_ADDR_LEN], hwaddr_long[MAX_ADDR_LEN];
+    uint16_t channel, page, nid, src_len;
+    int16_t tx_power;
+    uint8_t retrans, csma_retries;
     int res;
     netopt_state_t state;
-    netopt_enable_t enable = NETOPT_DISABLE;
+    netopt_enable_t flags[_LIST_FLAGS_NUMOF];
+    gnrc_netapi_opt_req_t reqs[_LIST_FLAGS + _LIST_FLAGS_NUMOF];
     bool linebreak = false;
 
 #ifdef MODULE_GNRC_IPV6_NETIF
@@ -292,10 +339,31 @@ static void _netif_list(kernel_pid_t dev)
     char ipv6_addr[IPV6_ADDR_MAX_STR_LEN];
 #endif
 
+    /* get all options in one round trip through the interface's thread */
+    _get_req(&reqs[_LIST_ADDRESS], NETOPT_ADDRESS, hwaddr, sizeof(hwaddr));
+    _get_req(&reqs[_LIST_CHANNEL], NETOPT_CHANNEL, &channel, sizeof(channel));
+    _get_req(&reqs[_LIST_CHANNEL_PAGE], NETOPT_CHANNEL_PAGE, &page,
+             sizeof(page));
+    _get_req(&reqs[_LIST_NID], NETOPT_NID, &nid, sizeof(nid));
+    _get_req(&reqs[_LIST_ADDRESS_LONG], NETOPT_ADDRESS_LONG, hwaddr_long,
+             sizeof(hwaddr_long));
+    _get_req(&reqs[_LIST_TX_POWER], NETOPT_TX_POWER, &tx_power,
+             sizeof(tx_power));
+    _get_req(&reqs[_LIST_STATE], NETOPT_STATE, &state, sizeof(state));
+    _get_req(&reqs[_LIST_RETRANS], NETOPT_RETRANS, &retrans, sizeof(retrans));
+    _get_req(&reqs[_LIST_CSMA_RETRIES], NETOPT_CSMA_RETRIES, &csma_retries,
+             sizeof(csma_retries));
+    _get_req(&reqs[_LIST_SRC_LEN], NETOPT_SRC_LEN, &src_len, sizeof(src_len));
+    for (unsigned i = 0; i < _LIST_FLAGS_NUMOF; i++) {
+        flags[i] = NETOPT_DISABLE;
+        _get_req(&reqs[_LIST_FLAGS + i], _list_flags[i].opt, &flags[i],
+                 sizeof(flags[i]));
+    }
+    gnrc_netapi_opts(dev, reqs, sizeof(reqs) / sizeof(reqs[0]));
 
     printf("Iface %2d  ", dev);
 
-    res = gnrc_netapi_get(dev, NETOPT_ADDRESS, 0, hwaddr, sizeof(hwaddr));
+    res = reqs[_LIST_ADDRESS].res;
 
     if (res >= 0) {
         char hwaddr_str[res * 3];
@@ -305,33 +373,27 @@ static void _netif_list(kernel_pid_t dev)
         printf(" ");
     }
 
-    res = gnrc_netapi_get(dev, NETOPT_CHANNEL, 0, &u16, sizeof(u16));
-
-    if (res >= 0) {
-        printf(" Channel: %" PRIu16 " ", u16);
+    if (reqs[_LIST_CHANNEL].res >= 0) {
+        printf(" Channel: %" PRIu16 " ", channel);
     }
 
-    res = gnrc_netapi_get(dev, NETOPT_CHANNEL_PAGE, 0, &u16, sizeof(u16));
-
-    if (res >= 0) {
-        printf(" Page: %" PRIu16 " ", u16);
+    if (reqs[_LIST_CHANNEL_PAGE].res >= 0) {
+        printf(" Page: %" PRIu16 " ", page);
     }
 
-    res = gnrc_netapi_get(dev, NETOPT_NID, 0, &u16, sizeof(u16));
-
-    if (res >= 0) {
-        printf(" NID: 0x%" PRIx16, u16);
+    if (reqs[_LIST_NID].res >= 0) {
+        printf(" NID: 0x%" PRIx16, nid);
     }
 
     printf("\n           ");
 
-    res = gnrc_netapi_get(dev, NETOPT_ADDRESS_LONG, 0, hwaddr, sizeof(hwaddr));
+    res = reqs[_LIST_ADDRESS_LONG].res;
 
     if (res >= 0) {
         char hwaddr_str[res * 3];
         printf("Long HWaddr: ");
         printf("%s ", gnrc_netif_addr_to_str(hwaddr_str, sizeof(hwaddr_str),
-                                             hwaddr, res));
+                                             hwaddr_long, res));
         linebreak = true;
     }
 
@@ -339,84 +401,33 @@ static void _netif_list(kernel_pid_t dev)
         printf("\n          ");
     }
 
-    res = gnrc_netapi_get(dev, NETOPT_TX_POWER, 0, &i16, sizeof(i16));
-
-    if (res >= 0) {
-        printf(" TX-Power: %" PRIi16 "dBm ", i16);
+    if (reqs[_LIST_TX_POWER].res >= 0) {
+        printf(" TX-Power: %" PRIi16 "dBm ", tx_power);
     }
 
-    res = gnrc_netapi_get(dev, NETOPT_STATE, 0, &state, sizeof(state));
-
-    if (res >= 0) {
+    if (reqs[_LIST_STATE].res >= 0) {
         printf(" State: ");
         _print_netopt_state(state);
         printf(" ");
     }
 
-    res = gnrc_netapi_get(dev, NETOPT_RETRANS, 0, &u8, sizeof(u8));
-
-    if (res >= 0) {
-        printf(" max. Retrans.: %u ", (unsigned)u8);
+    if (reqs[_LIST_RETRANS].res >= 0) {
+        printf(" max. Retrans.: %u ", (unsigned)retrans);
     }
 
-    res = gnrc_netapi_get(dev, NETOPT_CSMA_RETRIES, 0, &u8, sizeof(u8));
-
-    if (res >= 0) {
-        res = gnrc_netapi_get(dev, NETOPT_CSMA, 0, &enable, sizeof(enable));
-        if ((res >= 0) && (enable == NETOPT_ENABLE)) {
-            printf(" CSMA Retries: %u ", (unsigned)u8);
-        }
+    if ((reqs[_LIST_CSMA_RETRIES].res >= 0) &&
+        (reqs[_LIST_FLAGS + _LIST_CSMA_FLAG].res >= 0) &&
+        (flags[_LIST_CSMA_FLAG] == NETOPT_ENABLE)) {
+        printf(" CSMA Retries: %u ", (unsigned)csma_retries);
     }
 
     printf("\n           ");
 
-    res = gnrc_netapi_get(dev, NETOPT_PROMISCUOUSMODE, 0, &enable, sizeof(enable));
-
-    if ((res >= 0) && (enable == NETOPT_ENABLE)) {
-        printf("PROMISC  ");
-        linebreak = true;
-    }
-
-    res = gnrc_netapi_get(dev, NETOPT_AUTOACK, 0, &enable, sizeof(enable));
-
-    if ((res >= 0) && (enable == NETOPT_ENABLE)) {
-        printf("AUTOACK  ");
-        linebreak = true;
-    }
-
-    res = gnrc_netapi_get(dev, NETOPT_ACK_REQ, 0, &enable, sizeof(enable));
-
-    if ((res >= 0) && (enable == NETOPT_ENABLE)) {
-        printf("ACK_REQ  ");
-        linebreak = true;
-    }
-
-    res = gnrc_netapi_get(dev, NETOPT_PRELOADING, 0, &enable, sizeof(enable));
-
-    if ((res >= 0) && (enable == NETOPT_ENABLE)) {
-        printf("PRELOAD  ");
-        linebreak = true;
-    }
-
-    res = gnrc_netapi_get(dev, NETOPT_RAWMODE, 0, &enable, sizeof(enable));
-
-    if ((res >= 0) && (enable == NETOPT_ENABLE)) {
-        printf("RAWMODE  ");
-        linebreak = true;
-    }
-
-    res = gnrc_netapi_get(dev, NETOPT_CSMA, 0, &enable, sizeof(enable));
-
-    if ((res >= 0) && (enable == NETOPT_ENABLE)) {
-        printf("CSMA  ");
-        linebreak = true;
-    }
-
-    res = gnrc_netapi_get(dev, NETOPT_AUTOCCA, 0, &enable, sizeof(enable));
-
-    if ((res >= 0) && (enable == NETOPT_ENABLE)) {
-        printf("AUTOCCA  ");
-        linebreak = true;
+    for (unsigned i = 0; i < _LIST_FLAGS_NUMOF; i++) {
+        if ((reqs[_LIST_FLAGS + i].res >= 0) && (flags[i] == NETOPT_ENABLE)) {
+            printf("%s  ", _list_flags[i].name);
+            linebreak = true;
+        }
     }
 
 #ifdef MODULE_GNRC_IPV6_NETIF
@@ -450,10 +461,8 @@ static void _netif_list(kernel_pid_t dev)
         printf("\n           ");
     }
 
-    res = gnrc_netapi_get(dev, NETOPT_SRC_LEN, 0, &u16, sizeof(u16));
-
-    if (res >= 0) {
-        printf("Source address length: %" PRIu16 "\n           ", u16);
+    if (reqs[_LIST_SRC_LEN].res >= 0) {
+        printf("Source address length: %" PRIu16 "\n           ", src_len);
     }
 
 #ifdef MODULE_GNRC_IPV6_NETIF
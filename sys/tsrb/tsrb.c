@@ -17,8 +17,17 @@
  * @}
  */
 
+#include <string.h>
+
 #include "tsrb.h"
 
+/* Keeps the compiler from moving accesses to the buffer across updates of
+ * rb->reads or rb->writes, which hand the buffer over to the other side */
+static inline void _barrier(void)
+{
+    __asm__ volatile ("" : : : "memory");
+}
+
 static void _push(tsrb_t *rb, char c)
 {
     rb->buf[rb->writes++ & (rb->size - 1)] = c;
@@ -32,7 +41,7 @@ static char _pop(tsrb_t *rb)
 int tsrb_get_one(tsrb_t *rb)
 {
     if (!tsrb_empty(rb)) {
-        return _pop(rb);
+        return (unsigned char)_pop(rb);
     }
     else {
         return -1;
@@ -41,12 +50,43 @@ int tsrb_get_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, char *dst, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
+    unsigned reads = rb->reads;
+    unsigned pos = reads & (rb->size - 1);
+    size_t avail = rb->writes - reads;
+
+    if (n > avail) {
+        n = avail;
+    }
+    _barrier();
+    if ((rb->size - pos) >= n) {
+        memcpy(dst, &rb->buf[pos], n);
+    }
+    else {
+        size_t bytes_till_end = rb->size - pos;
+
+        memcpy(dst, &rb->buf[pos], bytes_till_end);
+        memcpy(dst + bytes_till_end, rb->buf, n - bytes_till_end);
     }
-    return (n - tmp);
+    _barrier();
+    rb->reads = reads + n;
+    return n;
+}
+
+size_t tsrb_get_region(tsrb_t *rb, char **region)
+{
+    unsigned reads = rb->reads;
+    unsigned pos = reads & (rb->size - 1);
+    size_t avail = rb->writes - reads;
+
+    _barrier();
+    *region = &rb->buf[pos];
+    return ((rb->size - pos) < avail) ? (rb->size - pos) : avail;
+}
+
+void tsrb_get_commit(tsrb_t *rb, size_t n)
+{
+    _barrier();
+    rb->reads += n;
 }
 
 int tsrb_add_one(tsrb_t *rb, char c)
@@ -62,10 +102,41 @@ int tsrb_add_one(tsrb_t *rb, char c)
 
 int tsrb_add(tsrb_t *rb, const char *src, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    unsigned writes = rb->writes;
+    unsigned pos = writes & (rb->size - 1);
+    size_t space = rb->size - (writes - rb->reads);
+
+    if (n > space) {
+        n = space;
+    }
+    _barrier();
+    if ((rb->size - pos) >= n) {
+        memcpy(&rb->buf[pos], src, n);
+    }
+    else {
+        size_t bytes_till_end = rb->size - pos;
+
+        memcpy(&rb->buf[pos], src, bytes_till_end);
+        memcpy(rb->buf, src + bytes_till_end, n - bytes_till_end);
     }
-    return (n - tmp);
+    _barrier();
+    rb->writes = writes + n;
+    return n;
+}
+
+size_t tsrb_add_region(tsrb_t *rb, char **region)
+{
+    unsigned writes = rb->writes;
+    unsigned pos = writes & (rb->size - 1);
+    size_t space = rb->size - (writes - rb->reads);
+
+    _barrier();
+    *region = &rb->buf[pos];
+    return ((rb->size - pos) < space) ? (rb->size - pos) : space;
+}
+
+void tsrb_add_commit(tsrb_t *rb, size_t n)
+{
+    _barrier();
+    rb->writes += n;
 }
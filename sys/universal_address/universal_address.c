@@ -33,6 +33,10 @@
 
 /**
  * @brief Maximum number of entries handled
+ *
+ * Routes sharing a next hop share its container, so this can be sized
+ * independently of the FIB, e.g. to a fraction of `2 * GNRC_IPV6_FIB_TABLE_SIZE`
+ * for large routing tables with few next hops.
  */
 /* determine the maximum numer of entries */
 #ifndef UNIVERSAL_ADDRESS_MAX_ENTRIES
@@ -46,6 +50,21 @@
 #   define UNIVERSAL_ADDRESS_MAX_ENTRIES    (UA_ADD0)
 #endif
 
+#if UNIVERSAL_ADDRESS_MAX_ENTRIES >= UINT16_MAX
+#error "UNIVERSAL_ADDRESS_MAX_ENTRIES must be smaller than UINT16_MAX"
+#endif
+
+/**
+ * @brief Number of buckets of the address index
+ */
+#ifndef UNIVERSAL_ADDRESS_HASH_SIZE
+#   if UNIVERSAL_ADDRESS_MAX_ENTRIES > 0
+#       define UNIVERSAL_ADDRESS_HASH_SIZE  (UNIVERSAL_ADDRESS_MAX_ENTRIES)
+#   else
+#       define UNIVERSAL_ADDRESS_HASH_SIZE  (1)
+#   endif
+#endif
+
 /**
  * @brief counter indicating the number of entries allocated
  */
@@ -56,11 +75,47 @@ static size_t universal_address_table_filled = 0;
  */
 static universal_address_container_t universal_address_table[UNIVERSAL_ADDRESS_MAX_ENTRIES];
 
+/**
+ * @brief First entry of each bucket of the address index, as index + 1 into
+ *        universal_address_table, 0 if the bucket is empty
+ */
+static uint16_t universal_address_buckets[UNIVERSAL_ADDRESS_HASH_SIZE];
+
+/**
+ * @brief Next entry in the same bucket or in the free list, as index + 1 into
+ *        universal_address_table, 0 at the end of the list
+ */
+static uint16_t universal_address_next[UNIVERSAL_ADDRESS_MAX_ENTRIES];
+
+/**
+ * @brief Unused entries released by universal_address_rem(), as index + 1
+ */
+static uint16_t universal_address_free = 0;
+
+/**
+ * @brief Number of entries that were never used since the last reset
+ */
+static uint16_t universal_address_untouched = 0;
+
 /**
  * @brief access mutex to control exclusive operations on calls
  */
 static mutex_t mtx_access = MUTEX_INIT;
 
+/**
+ * @brief hashes an address to its bucket in the address index (FNV-1a)
+ */
+static inline uint16_t *universal_address_bucket(const uint8_t *addr, size_t addr_size)
+{
+    uint32_t hash = 2166136261U;
+
+    for (size_t i = 0; i < addr_size; ++i) {
+        hash = (hash ^ addr[i]) * 16777619U;
+    }
+
+    return &universal_address_buckets[hash % UNIVERSAL_ADDRESS_HASH_SIZE];
+}
+
 /**
  * @brief finds the universal address container for the given address
  *
@@ -72,12 +127,16 @@ static mutex_t mtx_access = MUTEX_INIT;
  */
 static universal_address_container_t *universal_address_find_entry(uint8_t *addr, size_t addr_size)
 {
-    for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-        if (universal_address_table[i].address_size == addr_size) {
-            if (memcmp((universal_address_table[i].address), addr, addr_size) == 0) {
-                return &(universal_address_table[i]);
-            }
+    uint16_t i = *universal_address_bucket(addr, addr_size);
+
+    while (i != 0) {
+        universal_address_container_t *entry = &universal_address_table[i - 1];
+
+        if ((entry->address_size == addr_size) &&
+            (memcmp(entry->address, addr, addr_size) == 0)) {
+            return entry;
         }
+        i = universal_address_next[i - 1];
     }
 
     return NULL;
@@ -91,17 +150,42 @@ static universal_address_container_t *universal_address_find_entry(uint8_t *addr
  */
 static universal_address_container_t *universal_address_get_next_unused_entry(void)
 {
-    if (universal_address_table_filled < UNIVERSAL_ADDRESS_MAX_ENTRIES) {
-        for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
-            if (universal_address_table[i].use_count == 0) {
-                return &(universal_address_table[i]);
-            }
-        }
+    if (universal_address_free != 0) {
+        uint16_t i = universal_address_free;
+
+        universal_address_free = universal_address_next[i - 1];
+        return &(universal_address_table[i - 1]);
+    }
+
+    if (universal_address_untouched < UNIVERSAL_ADDRESS_MAX_ENTRIES) {
+        return &(universal_address_table[universal_address_untouched++]);
     }
 
     return NULL;
 }
 
+/**
+ * @brief removes an entry from the address index and puts it to the free list
+ *
+ * @param[in] entry  pointer to the unused universal_address_container_t
+ */
+static void universal_address_release_entry(universal_address_container_t *entry)
+{
+    uint16_t idx = (entry - universal_address_table) + 1;
+    uint16_t *i = universal_address_bucket(entry->address, entry->address_size);
+
+    while (*i != 0) {
+        if (*i == idx) {
+            *i = universal_address_next[idx - 1];
+            break;
+        }
+        i = &universal_address_next[*i - 1];
+    }
+
+    universal_address_next[idx - 1] = universal_address_free;
+    universal_address_free = idx;
+}
+
 universal_address_container_t *universal_address_add(uint8_t *addr, size_t addr_size)
 {
     mutex_lock(&mtx_access);
@@ -124,11 +208,23 @@ universal_address_container_t *universal_address_add(uint8_t *addr, size_t addr_
 
             /* set the used bytes */
             pEntry->address_size = addr_size;
-            pEntry->use_count = 0;
         }
+        pEntry->use_count = 0;
 
         /* copy the address */
         memcpy((pEntry->address), addr, addr_size);
+
+        /* and make it findable */
+        uint16_t *bucket = universal_address_bucket(addr, addr_size);
+        uint16_t idx = (pEntry - universal_address_table) + 1;
+
+        universal_address_next[idx - 1] = *bucket;
+        *bucket = idx;
+    }
+    else if (pEntry->use_count == UINT16_MAX) {
+        mutex_unlock(&mtx_access);
+        /* the entry can not be referenced any more often */
+        return NULL;
     }
 
     pEntry->use_count++;
@@ -148,13 +244,14 @@ void universal_address_rem(universal_address_container_t *entry)
     mutex_lock(&mtx_access);
     DEBUG("[universal_address_rem] entry: %p\n", (void *)entry);
 
-    /* we do not delete anything on remove */
+    /* the address is kept until the entry is reused */
     if (entry != NULL) {
         if (entry->use_count != 0) {
             entry->use_count--;
 
             if (entry->use_count == 0) {
                 universal_address_table_filled--;
+                universal_address_release_entry(entry);
             }
         }
         else {
@@ -299,6 +396,10 @@ void universal_address_init(void)
         universal_address_table[i].address_size = 0;
         memset(universal_address_table[i].address, 0, UNIVERSAL_ADDRESS_SIZE);
     }
+    memset(universal_address_buckets, 0, sizeof(universal_address_buckets));
+    universal_address_free = 0;
+    universal_address_untouched = 0;
+    universal_address_table_filled = 0;
 
     mutex_unlock(&mtx_access);
 }
@@ -310,6 +411,9 @@ void universal_address_reset(void)
     for (size_t i = 0; i < UNIVERSAL_ADDRESS_MAX_ENTRIES; ++i) {
         universal_address_table[i].use_count = 0;
     }
+    memset(universal_address_buckets, 0, sizeof(universal_address_buckets));
+    universal_address_free = 0;
+    universal_address_untouched = 0;
 
     universal_address_table_filled = 0;
     mutex_unlock(&mtx_access);
@@ -64,6 +64,7 @@ void _xtimer_periodic_wakeup(uint32_t *last_wakeup, uint32_t period) {
 
     timer.callback = _callback_unlock_mutex;
     timer.arg = (void*) &mutex;
+    timer.target = timer.long_target = 0;
 
     uint32_t target = (*last_wakeup) + period;
     uint32_t now = _xtimer_now();
@@ -31,19 +31,30 @@
 static volatile int _in_handler = 0;
 
 static volatile uint32_t _long_cnt = 0;
+static volatile uint32_t _wakeups = 0;
 #if XTIMER_MASK
 volatile uint32_t _xtimer_high_cnt = 0;
 #endif
 
 static inline void xtimer_spin_until(uint32_t value);
 
+#ifdef MODULE_XTIMER_HEAP
+static xtimer_t *_heap = NULL;
+#else
 static xtimer_t *timer_list_head = NULL;
 static xtimer_t *overflow_list_head = NULL;
 static xtimer_t *long_list_head = NULL;
 
 static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer);
 static void _add_timer_to_long_list(xtimer_t **list_head, xtimer_t *timer);
+#endif
+
+static void _add(xtimer_t *timer, uint32_t now);
+static void _del(xtimer_t *timer);
+static inline xtimer_t *_first(void);
+static void _period_advanced(void);
 static void _shoot(xtimer_t *timer);
+static int _set_absolute(xtimer_t *timer, uint32_t target, uint32_t slack);
 static void _remove(xtimer_t *timer);
 static inline void _lltimer_set(uint32_t target);
 static uint32_t _time_left(uint32_t target, uint32_t reference);
@@ -58,6 +69,20 @@ static inline int _is_set(xtimer_t *timer)
     return (timer->target || timer->long_target);
 }
 
+/**
+ * @brief time left until @p timer may fire, i.e. until its target minus slack
+ */
+static inline uint32_t _soft_time_left(xtimer_t *timer, uint32_t reference)
+{
+    uint32_t left = _time_left(_xtimer_lltimer_mask(timer->target), reference);
+
+#ifdef MODULE_XTIMER_SLACK
+    return (left > timer->slack) ? (left - timer->slack) : 0;
+#else
+    return left;
+#endif
+}
+
 static inline void xtimer_spin_until(uint32_t target) {
 #if XTIMER_MASK
     target = _xtimer_lltimer_mask(target);
@@ -118,8 +143,11 @@ void _xtimer_set64(xtimer_t *timer, uint32_t offset, uint32_t long_offset)
         if (timer->target < offset) {
             timer->long_target++;
         }
+#ifdef MODULE_XTIMER_SLACK
+        timer->slack = 0;
+#endif
 
-        _add_timer_to_long_list(&long_list_head, timer);
+        _add(timer, _xtimer_now());
         irq_restore(state);
         DEBUG("xtimer_set64(): added longterm timer (long_target=%" PRIu32 " target=%" PRIu32 ")\n",
                 timer->long_target, timer->target);
@@ -146,10 +174,44 @@ void _xtimer_set(xtimer_t *timer, uint32_t offset)
     }
 }
 
+void _xtimer_set_slack(xtimer_t *timer, uint32_t offset, uint32_t slack)
+{
+#ifdef MODULE_XTIMER_SLACK
+    DEBUG("timer_set_slack(): offset=%" PRIu32 " slack=%" PRIu32 "\n", offset, slack);
+    if (!timer->callback) {
+        DEBUG("timer_set_slack(): timer has no callback.\n");
+        return;
+    }
+
+    xtimer_remove(timer);
+
+    if (offset < XTIMER_BACKOFF) {
+        _xtimer_spin(offset);
+        _shoot(timer);
+    }
+    else {
+        /* timers are ordered by the latest time they may fire at */
+        if (slack > (UINT32_MAX - offset)) {
+            slack = UINT32_MAX - offset;
+        }
+        _set_absolute(timer, _xtimer_now() + offset + slack, slack);
+    }
+#else
+    (void)slack;
+    _xtimer_set(timer, offset);
+#endif
+}
+
+uint32_t xtimer_wakeups(void)
+{
+    return _wakeups;
+}
+
 static void _periph_timer_callback(void *arg, int chan)
 {
     (void)arg;
     (void)chan;
+    _wakeups++;
     _timer_callback();
 }
 
@@ -168,13 +230,17 @@ static inline void _lltimer_set(uint32_t target)
 }
 
 int _xtimer_set_absolute(xtimer_t *timer, uint32_t target)
+{
+    return _set_absolute(timer, target, 0);
+}
+
+static int _set_absolute(xtimer_t *timer, uint32_t target, uint32_t slack)
 {
     uint32_t now = _xtimer_now();
     int res = 0;
 
     DEBUG("timer_set_absolute(): now=%" PRIu32 " target=%" PRIu32 "\n", now, target);
 
-    timer->next = NULL;
     if ((target >= now) && ((target - XTIMER_BACKOFF) < now)) {
         /* backoff */
         xtimer_spin_until(target + XTIMER_BACKOFF);
@@ -192,25 +258,16 @@ int _xtimer_set_absolute(xtimer_t *timer, uint32_t target)
     if (target < now) {
         timer->long_target++;
     }
+#ifdef MODULE_XTIMER_SLACK
+    timer->slack = slack;
+#else
+    (void)slack;
+#endif
 
-    if ( (timer->long_target > _long_cnt) || !_this_high_period(target) ) {
-        DEBUG("xtimer_set_absolute(): the timer doesn't fit into the low-level timer's mask.\n");
-        _add_timer_to_long_list(&long_list_head, timer);
-    }
-    else {
-        if (_xtimer_lltimer_mask(now) >= target) {
-            DEBUG("xtimer_set_absolute(): the timer will expire in the next timer period\n");
-            _add_timer_to_list(&overflow_list_head, timer);
-        }
-        else {
-            DEBUG("timer_set_absolute(): timer will expire in this timer period.\n");
-            _add_timer_to_list(&timer_list_head, timer);
-
-            if (timer_list_head == timer) {
-                DEBUG("timer_set_absolute(): timer is new list head. updating lltimer.\n");
-                _lltimer_set(target - XTIMER_OVERHEAD);
-            }
-        }
+    _add(timer, now);
+    if (_first() == timer) {
+        DEBUG("timer_set_absolute(): timer expires first. updating lltimer.\n");
+        _lltimer_set(target - XTIMER_OVERHEAD);
     }
 
     irq_restore(state);
@@ -218,6 +275,7 @@ int _xtimer_set_absolute(xtimer_t *timer, uint32_t target)
     return res;
 }
 
+#ifndef MODULE_XTIMER_HEAP
 static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer)
 {
     while (*list_head && (*list_head)->target <= timer->target) {
@@ -253,63 +311,6 @@ static int _remove_timer_from_list(xtimer_t **list_head, xtimer_t *timer)
     return 0;
 }
 
-static void _remove(xtimer_t *timer)
-{
-    if (timer_list_head == timer) {
-        uint32_t next;
-        timer_list_head = timer->next;
-        if (timer_list_head) {
-            /* schedule callback on next timer target time */
-            next = timer_list_head->target - XTIMER_OVERHEAD;
-        }
-        else {
-            next = _xtimer_lltimer_mask(0xFFFFFFFF);
-        }
-        _lltimer_set(next);
-    }
-    else {
-        if (!_remove_timer_from_list(&timer_list_head, timer)) {
-            if (!_remove_timer_from_list(&overflow_list_head, timer)) {
-                _remove_timer_from_list(&long_list_head, timer);
-            }
-        }
-    }
-}
-
-void xtimer_remove(xtimer_t *timer)
-{
-    int state = irq_disable();
-    if (_is_set(timer)) {
-        _remove(timer);
-    }
-    irq_restore(state);
-}
-
-static uint32_t _time_left(uint32_t target, uint32_t reference)
-{
-    uint32_t now = _xtimer_lltimer_now();
-
-    if (now < reference) {
-        return 0;
-    }
-
-    if (target > now) {
-        return target - now;
-    }
-    else {
-        return 0;
-    }
-}
-
-static inline int _this_high_period(uint32_t target) {
-#if XTIMER_MASK
-    return (target & XTIMER_MASK) == _xtimer_high_cnt;
-#else
-    (void)target;
-    return 1;
-#endif
-}
-
 /**
  * @brief compare two timers' target values, return the one with lower value.
  *
@@ -400,6 +401,241 @@ static void _select_long_timers(void)
     }
 }
 
+static void _add(xtimer_t *timer, uint32_t now)
+{
+    if ( (timer->long_target > _long_cnt) || !_this_high_period(timer->target) ) {
+        DEBUG("_add(): the timer doesn't fit into the low-level timer's mask.\n");
+        _add_timer_to_long_list(&long_list_head, timer);
+    }
+    else if (_xtimer_lltimer_mask(now) >= timer->target) {
+        DEBUG("_add(): the timer will expire in the next timer period\n");
+        _add_timer_to_list(&overflow_list_head, timer);
+    }
+    else {
+        DEBUG("_add(): timer will expire in this timer period.\n");
+        _add_timer_to_list(&timer_list_head, timer);
+    }
+}
+
+static void _del(xtimer_t *timer)
+{
+    if (!_remove_timer_from_list(&timer_list_head, timer)) {
+        if (!_remove_timer_from_list(&overflow_list_head, timer)) {
+            _remove_timer_from_list(&long_list_head, timer);
+        }
+    }
+}
+
+static inline xtimer_t *_first(void)
+{
+    return timer_list_head;
+}
+
+static void _period_advanced(void)
+{
+    /* swap overflow list to current timer list */
+    timer_list_head = overflow_list_head;
+    overflow_list_head = NULL;
+
+    _select_long_timers();
+}
+#endif /* MODULE_XTIMER_HEAP */
+
+#ifdef MODULE_XTIMER_HEAP
+/**
+ * @brief   Checks if @p a expires before @p b
+ */
+static inline int _before(const xtimer_t *a, const xtimer_t *b)
+{
+    return (a->long_target < b->long_target) ||
+           ((a->long_target == b->long_target) && (a->target < b->target));
+}
+
+/**
+ * @brief   Melds two heaps, the later root becomes the first child
+ *
+ * On equal targets @p a stays root, so timers set earlier fire first.
+ */
+static xtimer_t *_meld(xtimer_t *a, xtimer_t *b)
+{
+    if (_before(b, a)) {
+        xtimer_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+/**
+ * @brief   Melds a list of sibling heaps pairwise, then all pairs into one
+ */
+static xtimer_t *_merge_pairs(xtimer_t *first)
+{
+    xtimer_t *pairs = NULL;
+
+    /* left to right: meld pairs, collect them in reverse order */
+    while (first) {
+        xtimer_t *a = first;
+        xtimer_t *b = a->next;
+
+        a->prev = NULL;
+        if (b) {
+            first = b->next;
+            a->next = NULL;
+            b->prev = NULL;
+            b->next = NULL;
+            a = _meld(a, b);
+        }
+        else {
+            first = NULL;
+        }
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* right to left: meld the pairs into the result */
+    first = pairs;
+    if (first) {
+        pairs = first->next;
+        first->next = NULL;
+        while (pairs) {
+            xtimer_t *pair = pairs;
+
+            pairs = pair->next;
+            pair->next = NULL;
+            first = _meld(pair, first);
+        }
+    }
+
+    return first;
+}
+
+static void _add(xtimer_t *timer, uint32_t now)
+{
+    (void)now;
+
+    timer->child = NULL;
+    timer->next = NULL;
+    timer->prev = NULL;
+    _heap = _heap ? _meld(_heap, timer) : timer;
+}
+
+static void _del(xtimer_t *timer)
+{
+    if ((timer != _heap) && !timer->prev) {
+        /* not in the heap */
+        return;
+    }
+
+    xtimer_t *children = _merge_pairs(timer->child);
+
+    if (timer == _heap) {
+        _heap = children;
+    }
+    else {
+        /* prev is either the parent or the left sibling */
+        if (timer->prev->child == timer) {
+            timer->prev->child = timer->next;
+        }
+        else {
+            timer->prev->next = timer->next;
+        }
+        if (timer->next) {
+            timer->next->prev = timer->prev;
+        }
+        if (children) {
+            _heap = _meld(_heap, children);
+        }
+    }
+
+    timer->child = NULL;
+    timer->next = NULL;
+    timer->prev = NULL;
+}
+
+static inline xtimer_t *_first(void)
+{
+    /* the earliest timer only matters once it expires in this period */
+    if (_heap && (_heap->long_target <= _long_cnt) &&
+        _this_high_period(_heap->target)) {
+        return _heap;
+    }
+    return NULL;
+}
+
+static void _period_advanced(void)
+{
+    /* all timers are kept in one heap, nothing to move */
+}
+#endif /* MODULE_XTIMER_HEAP */
+
+static void _remove(xtimer_t *timer)
+{
+    if (_first() == timer) {
+        xtimer_t *next;
+        uint32_t next_target;
+
+        _del(timer);
+        if ((next = _first())) {
+            /* schedule callback on next timer target time */
+            next_target = next->target - XTIMER_OVERHEAD;
+        }
+        else {
+            next_target = _xtimer_lltimer_mask(0xFFFFFFFF);
+        }
+        _lltimer_set(next_target);
+    }
+    else {
+        _del(timer);
+    }
+
+    /* make sure timer is recognized as not being set anymore */
+    timer->target = 0;
+    timer->long_target = 0;
+}
+
+void xtimer_remove(xtimer_t *timer)
+{
+    int state = irq_disable();
+    if (_is_set(timer)) {
+        _remove(timer);
+    }
+    irq_restore(state);
+}
+
+static uint32_t _time_left(uint32_t target, uint32_t reference)
+{
+    uint32_t now = _xtimer_lltimer_now();
+
+    if (now < reference) {
+        return 0;
+    }
+
+    if (target > now) {
+        return target - now;
+    }
+    else {
+        return 0;
+    }
+}
+
+static inline int _this_high_period(uint32_t target) {
+#if XTIMER_MASK
+    return (target & XTIMER_MASK) == _xtimer_high_cnt;
+#else
+    (void)target;
+    return 1;
+#endif
+}
+
 /**
  * @brief handle low-level timer overflow, advance to next short timer period
  */
@@ -417,11 +653,7 @@ static void _next_period(void)
     _long_cnt++;
 #endif
 
-    /* swap overflow list to current timer list */
-    timer_list_head = overflow_list_head;
-    overflow_list_head = NULL;
-
-    _select_long_timers();
+    _period_advanced();
 }
 
 /**
@@ -429,6 +661,7 @@ static void _next_period(void)
  */
 static void _timer_callback(void)
 {
+    xtimer_t *timer;
     uint32_t next_target;
     uint32_t reference;
 
@@ -437,7 +670,7 @@ static void _timer_callback(void)
     DEBUG("_timer_callback() now=%" PRIu32 " (%" PRIu32 ")pleft=%" PRIu32 "\n", xtimer_now(),
             _xtimer_lltimer_mask(xtimer_now()), _xtimer_lltimer_mask(0xffffffff - xtimer_now()));
 
-    if (!timer_list_head) {
+    if (!_first()) {
         DEBUG("_timer_callback(): tick\n");
         /* there's no timer for this timer period,
          * so this was a timer overflow callback.
@@ -461,16 +694,14 @@ static void _timer_callback(void)
     }
 
 overflow:
-    /* check if next timers are close to expiring */
-    while (timer_list_head && (_time_left(_xtimer_lltimer_mask(timer_list_head->target), reference) < XTIMER_ISR_BACKOFF)) {
+    /* check if next timers are close to expiring, with slack this fires all
+     * timers whose window covers now in one go */
+    while ((timer = _first()) && (_soft_time_left(timer, reference) < XTIMER_ISR_BACKOFF)) {
         /* make sure we don't fire too early */
-        while (_time_left(_xtimer_lltimer_mask(timer_list_head->target), reference));
-
-        /* pick first timer in list */
-        xtimer_t *timer = timer_list_head;
+        while (_soft_time_left(timer, reference));
 
-        /* advance list */
-        timer_list_head = timer->next;
+        /* take the timer out */
+        _del(timer);
 
         /* make sure timer is recognized as being already fired */
         timer->target = 0;
@@ -485,15 +716,15 @@ overflow:
      * next timer period and check again for expired
      * timers.*/
     if (reference > _xtimer_lltimer_now()) {
-        DEBUG("_timer_callback: overflowed while executing callbacks. %i\n", timer_list_head != 0);
+        DEBUG("_timer_callback: overflowed while executing callbacks. %i\n", _first() != NULL);
         _next_period();
         reference = 0;
         goto overflow;
     }
 
-    if (timer_list_head) {
+    if ((timer = _first())) {
         /* schedule callback on next timer target time */
-        next_target = timer_list_head->target - XTIMER_OVERHEAD;
+        next_target = timer->target - XTIMER_OVERHEAD;
 
         /* make sure we're not setting a time in the past */
         if (next_target < (_xtimer_lltimer_now() + XTIMER_ISR_BACKOFF)) {
@@ -0,0 +1,27 @@
+/* DO NOT edit this file, your changes will be overwritten and won't take any effect! */
+/* Generated from CFLAGS: -DENTRIES_MAX=4096U -DUNIVERSAL_ADDRESS_MAX_ENTRIES=4130 -DUNIVERSAL_ADDRESS_SIZE=16 -Werror -Wall -Wextra -pedantic -std=gnu99 -ffunction-sections -fdata-sections -DDEBUG_ASSERT_VERBOSE -DBOARD_NATIVE="native" -DRIOT_BOARD=BOARD_NATIVE -DCPU_NATIVE="native" -DRIOT_CPU=CPU_NATIVE -DMCU_NATIVE="native" -DRIOT_MCU=MCU_NATIVE -fno-delete-null-pointer-checks -Wstrict-prototypes -Werror=strict-prototypes -Wold-style-definition -Werror=old-style-definition -fno-common -Wall -DNDEBUG -DFEATURE_PERIPH_TIMER -DMODULE_AUTO_INIT -DMODULE_BOARD -DMODULE_CORE -DMODULE_CORE_MSG -DMODULE_CPU -DMODULE_DIV -DMODULE_FIB -DMODULE_NATIVE_DRIVERS -DMODULE_PERIPH -DMODULE_SYS -DMODULE_UNIVERSAL_ADDRESS -DMODULE_XTIMER -DRIOT_VERSION="1d3a-vm" */
+#define ENTRIES_MAX 4096U
+#define UNIVERSAL_ADDRESS_MAX_ENTRIES 4130
+#define UNIVERSAL_ADDRESS_SIZE 16
+#define DEBUG_ASSERT_VERBOSE 1
+#define BOARD_NATIVE "native"
+#define RIOT_BOARD BOARD_NATIVE
+#define CPU_NATIVE "native"
+#define RIOT_CPU CPU_NATIVE
+#define MCU_NATIVE "native"
+#define RIOT_MCU MCU_NATIVE
+#define NDEBUG 1
+#define FEATURE_PERIPH_TIMER 1
+#define MODULE_AUTO_INIT 1
+#define MODULE_BOARD 1
+#define MODULE_CORE 1
+#define MODULE_CORE_MSG 1
+#define MODULE_CPU 1
+#define MODULE_DIV 1
+#define MODULE_FIB 1
+#define MODULE_NATIVE_DRIVERS 1
+#define MODULE_PERIPH 1
+#define MODULE_SYS 1
+#define MODULE_UNIVERSAL_ADDRESS 1
+#define MODULE_XTIMER 1
+#define RIOT_VERSION "1d3a-vm"
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the next hop lookup rate of the FIB with many routes
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/fib.h"
+#include "xtimer.h"
+
+#ifndef ENTRIES_MAX
+#define ENTRIES_MAX     (256U)
+#endif
+#define LOOKUPS         (1000U)
+#define NEXT_HOPS       (32U)
+#define IFACE           (42)
+
+static const unsigned numofs[] = { 16, 256, ENTRIES_MAX };
+static fib_entry_t entries[ENTRIES_MAX];
+static fib_table_t fib_table = { .data.entries = entries,
+                                 .table_type = FIB_TABLE_TYPE_SH,
+                                 .size = ENTRIES_MAX,
+                                 .mtx_access = MUTEX_INIT,
+                                 .notify_rp_pos = 0 };
+
+/* constructs the address of a downward route on a RPL root */
+static void _addr(uint8_t *addr, unsigned i)
+{
+    memset(addr, 0, 16);
+    addr[0] = 0xfd;
+    addr[11] = 0xff;
+    addr[12] = 0xfe;
+    addr[14] = i >> 8;
+    addr[15] = i & 0xff;
+}
+
+static int _run(unsigned numof)
+{
+    uint8_t addr_dst[16], addr_nxt[16], addr_exp[16];
+    size_t addr_nxt_size;
+    kernel_pid_t iface_id;
+    uint32_t next_hop_flags, start, duration;
+
+    fib_init(&fib_table);
+    /* a default route and downward routes via a few direct children */
+    memset(addr_dst, 0, sizeof(addr_dst));
+    _addr(addr_nxt, UINT16_MAX);
+    if (fib_add_entry(&fib_table, IFACE, addr_dst, sizeof(addr_dst), 0,
+                      addr_nxt, sizeof(addr_nxt), 0,
+                      (uint32_t)FIB_LIFETIME_NO_EXPIRE) != 0) {
+        printf("%4u entries: unable to add default route\n", numof);
+        return 0;
+    }
+    for (unsigned i = 1; i < numof; i++) {
+        _addr(addr_dst, i);
+        _addr(addr_nxt, UINT16_MAX - (i % NEXT_HOPS));
+        if (fib_add_entry(&fib_table, IFACE, addr_dst, sizeof(addr_dst),
+                          FIB_FLAG_RPL_ROUTE, addr_nxt, sizeof(addr_nxt),
+                          FIB_FLAG_RPL_ROUTE, 100000) != 0) {
+            printf("%4u entries: unable to add route\n", numof);
+            return 0;
+        }
+    }
+    for (unsigned i = 1; i < numof; i++) {
+        _addr(addr_dst, i);
+        _addr(addr_exp, UINT16_MAX - (i % NEXT_HOPS));
+        addr_nxt_size = sizeof(addr_nxt);
+        if ((fib_get_next_hop(&fib_table, &iface_id, addr_nxt, &addr_nxt_size,
+                              &next_hop_flags, addr_dst, sizeof(addr_dst),
+                              0) != 0) ||
+            (memcmp(addr_nxt, addr_exp, sizeof(addr_exp)) != 0)) {
+            printf("%4u entries: lookup returned wrong next hop\n", numof);
+            return 0;
+        }
+    }
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < LOOKUPS; i++) {
+        /* scatter the lookups over the table */
+        _addr(addr_dst, 1 + ((i * 7919) % (numof - 1)));
+        addr_nxt_size = sizeof(addr_nxt);
+        fib_get_next_hop(&fib_table, &iface_id, addr_nxt, &addr_nxt_size,
+                         &next_hop_flags, addr_dst, sizeof(addr_dst), 0);
+    }
+    duration = xtimer_now_usec() - start;
+
+    printf("%4u entries: %" PRIu32 " lookups/s\n", numof,
+           (uint32_t)(((uint64_t)LOOKUPS * SEC_IN_USEC) / duration));
+    fib_deinit(&fib_table);
+    return 1;
+}
+
+int main(void)
+{
+    puts("FIB lookup benchmark");
+
+    for (unsigned i = 0; i < sizeof(numofs) / sizeof(numofs[0]); i++) {
+        /* the largest table may coincide with a smaller one */
+        if ((i > 0) && (numofs[i] <= numofs[i - 1])) {
+            break;
+        }
+        if (!_run(numofs[i])) {
+            puts("[FAILURE]");
+            return 1;
+        }
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the request rate of a gcoap server with many resources
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/coap.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "xtimer.h"
+
+#define LISTENERS       (8U)
+#define RESOURCES       (32U)
+#define PATH_LEN        (sizeof("/l0/r00"))
+#define DURATION        (2U * SEC_IN_USEC)
+#define TIMEOUT         (100U * MS_IN_USEC)
+
+static char paths[LISTENERS][RESOURCES][PATH_LEN];
+static coap_resource_t resources[LISTENERS][RESOURCES];
+static gcoap_listener_t listeners[LISTENERS];
+static sock_udp_t client;
+static uint8_t req_buf[GCOAP_PDU_BUF_SIZE];
+
+static ssize_t _handler(coap_pkt_t *pdu, uint8_t *buf, size_t len)
+{
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+static void _register(void)
+{
+    for (unsigned l = 0; l < LISTENERS; l++) {
+        for (unsigned r = 0; r < RESOURCES; r++) {
+            /* alphabetical order within a listener */
+            snprintf(paths[l][r], PATH_LEN, "/l%u/r%02u", l, r);
+            resources[l][r].path = paths[l][r];
+            resources[l][r].methods = COAP_GET;
+            resources[l][r].handler = _handler;
+        }
+        listeners[l].resources = resources[l];
+        listeners[l].resources_len = RESOURCES;
+        gcoap_register_listener(&listeners[l]);
+    }
+}
+
+/* Sends a request and returns the response code as class * 100 + detail */
+static int _request(unsigned method, char *path)
+{
+    sock_udp_ep_t remote = SOCK_IPV6_EP_ANY;
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    remote.port = GCOAP_PORT;
+
+    len = gcoap_request(&pdu, req_buf, sizeof(req_buf), method, path);
+    if ((len < 0) || (sock_udp_send(&client, req_buf, len, &remote) < 0)) {
+        return -1;
+    }
+    len = sock_udp_recv(&client, req_buf, sizeof(req_buf), TIMEOUT, NULL);
+    if ((len < 0) || (coap_parse(&pdu, req_buf, len) < 0)) {
+        return -1;
+    }
+    return (coap_get_code_class(&pdu) * 100) + coap_get_code_detail(&pdu);
+}
+
+static int _run(char *path)
+{
+    uint32_t start, duration, requests = 0;
+
+    start = xtimer_now_usec();
+    do {
+        if (_request(COAP_METHOD_GET, path) != 205) {
+            printf("%s: unexpected response\n", path);
+            return 0;
+        }
+        requests++;
+        duration = xtimer_now_usec() - start;
+    } while (duration < DURATION);
+
+    printf("%s: %" PRIu32 " requests/s\n", path,
+           (uint32_t)(((uint64_t)requests * SEC_IN_USEC) / duration));
+    return 1;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+    printf("gcoap benchmark (%u resources, index: on)\n", LISTENERS * RESOURCES);
+#else
+    printf("gcoap benchmark (%u resources, index: off)\n", LISTENERS * RESOURCES);
+#endif
+
+    _register();
+    local.port = GCOAP_PORT + 1;
+    if (sock_udp_create(&client, &local, NULL, 0) < 0) {
+        puts("unable to create client sock");
+        puts("[FAILURE]");
+        return 1;
+    }
+
+    if ((_request(COAP_METHOD_GET, "/l9/r00") != 404) ||
+        (_request(COAP_METHOD_POST, paths[0][0]) != 404)) {
+        puts("unexpected response for unknown resource");
+        puts("[FAILURE]");
+        return 1;
+    }
+    if (!_run(paths[0][0]) || !_run(paths[LISTENERS - 1][RESOURCES - 1])) {
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
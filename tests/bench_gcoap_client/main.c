@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the request rate of a gcoap client with many open requests
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/coap.h"
+#include "net/ipv6/addr.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define WINDOW          (4U)
+#define IDLE            (GCOAP_REQ_WAITING_MAX - WINDOW)
+#define DURATION        (2U * SEC_IN_USEC)
+#define TIMEOUT         (5U * SEC_IN_USEC)
+#define MAIN_QUEUE_SIZE (8U)
+
+static ssize_t _handler(coap_pkt_t *pdu, uint8_t *buf, size_t len);
+
+static const coap_resource_t resources[] = {
+    { "/bench", COAP_GET, _handler },
+};
+static gcoap_listener_t listener = {
+    (coap_resource_t *)&resources[0],
+    sizeof(resources) / sizeof(resources[0]),
+    NULL
+};
+static msg_t main_queue[MAIN_QUEUE_SIZE];
+static kernel_pid_t main_pid;
+static uint8_t req_buf[GCOAP_PDU_BUF_SIZE];
+
+static ssize_t _handler(coap_pkt_t *pdu, uint8_t *buf, size_t len)
+{
+    return gcoap_response(pdu, buf, len, COAP_CODE_CONTENT);
+}
+
+/* reports to main whether the request got the expected response */
+static void _resp_handler(unsigned req_state, coap_pkt_t *pdu)
+{
+    msg_t msg;
+
+    /* on timeout, pdu holds the request header */
+    msg.content.value = (req_state != GCOAP_MEMO_TIMEOUT) &&
+                        (req_state != GCOAP_MEMO_ERR) &&
+                        ((coap_get_code_class(pdu) * 100) +
+                         coap_get_code_detail(pdu) == 205);
+    msg_send(&msg, main_pid);
+}
+
+static int _request(unsigned type, uint16_t port)
+{
+    ipv6_addr_t addr = IPV6_ADDR_LOOPBACK;
+    coap_pkt_t pdu;
+    ssize_t len;
+
+    len = gcoap_request(&pdu, req_buf, sizeof(req_buf), COAP_METHOD_GET,
+                        "/bench");
+    if (len < 0) {
+        return -1;
+    }
+    gcoap_hdr_set_type(pdu.hdr, type);
+    return (gcoap_req_send(req_buf, len, &addr, port, _resp_handler) > 0) ? 0 : -1;
+}
+
+static int _run(const char *name, unsigned type)
+{
+    uint32_t start, duration, requests = 0, responses = 0;
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < WINDOW; i++) {
+        if (_request(type, GCOAP_PORT) < 0) {
+            printf("%s: unable to send request\n", name);
+            return 0;
+        }
+        requests++;
+    }
+    do {
+        msg_t msg;
+
+        if ((xtimer_msg_receive_timeout(&msg, TIMEOUT) < 0) ||
+            !msg.content.value) {
+            printf("%s: response missing or unexpected\n", name);
+            return 0;
+        }
+        responses++;
+        duration = xtimer_now_usec() - start;
+        if (duration < DURATION) {
+            if (_request(type, GCOAP_PORT) < 0) {
+                printf("%s: unable to send request\n", name);
+                return 0;
+            }
+            requests++;
+        }
+    } while (responses < requests);
+
+    printf("%s: %" PRIu32 " requests/s\n", name,
+           (uint32_t)(((uint64_t)responses * SEC_IN_USEC) / duration));
+    return 1;
+}
+
+int main(void)
+{
+#ifdef MODULE_GCOAP_REQ_INDEX
+    printf("gcoap client benchmark (%u idle requests, index: on)\n", IDLE);
+#else
+    printf("gcoap client benchmark (%u idle requests, index: off)\n", IDLE);
+#endif
+
+    main_pid = thread_getpid();
+    msg_init_queue(main_queue, MAIN_QUEUE_SIZE);
+    gcoap_register_listener(&listener);
+
+    /* nobody listens on the port, so these stay open */
+    for (unsigned i = 0; i < IDLE; i++) {
+        if (_request(COAP_TYPE_NON, GCOAP_PORT + 1) < 0) {
+            puts("unable to send idle request");
+            puts("[FAILURE]");
+            return 1;
+        }
+    }
+    if (!_run("NON", COAP_TYPE_NON) || !_run("CON", COAP_TYPE_CON)) {
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+/* DO NOT edit this file, your changes will be overwritten and won't take any effect! */
+/* Generated from CFLAGS: -Werror -Wall -Wextra -pedantic -std=gnu99 -ffunction-sections -fdata-sections -DDEBUG_ASSERT_VERBOSE -DBOARD_NATIVE="native" -DRIOT_BOARD=BOARD_NATIVE -DCPU_NATIVE="native" -DRIOT_CPU=CPU_NATIVE -DMCU_NATIVE="native" -DRIOT_MCU=MCU_NATIVE -fno-delete-null-pointer-checks -Wstrict-prototypes -Werror=strict-prototypes -Wold-style-definition -Werror=old-style-definition -fno-common -Wall -DNDEBUG -DSOCK_HAS_IPV6 -DFEATURE_PERIPH_TIMER -DMODULE_AUTO_INIT -DMODULE_BITFIELD -DMODULE_BOARD -DMODULE_CORE -DMODULE_CORE_MBOX -DMODULE_CORE_MSG -DMODULE_CPU -DMODULE_DIV -DMODULE_GNRC -DMODULE_GNRC_ICMPV6 -DMODULE_GNRC_IPV6 -DMODULE_GNRC_IPV6_DEFAULT -DMODULE_GNRC_IPV6_DST_CACHE -DMODULE_GNRC_IPV6_HDR -DMODULE_GNRC_IPV6_NC -DMODULE_GNRC_IPV6_NETIF -DMODULE_GNRC_NDP -DMODULE_GNRC_NDP_HOST -DMODULE_GNRC_NDP_INTERNAL -DMODULE_GNRC_NDP_NODE -DMODULE_GNRC_NETAPI -DMODULE_GNRC_NETAPI_MBOX -DMODULE_GNRC_NETIF -DMODULE_GNRC_NETIF_HDR -DMODULE_GNRC_NETREG -DMODULE_GNRC_PKT -DMODULE_GNRC_PKTBUF -DMODULE_GNRC_PKTBUF_STATIC -DMODULE_GNRC_SOCK -DMODULE_GNRC_SOCK_UDP -DMODULE_GNRC_UDP -DMODULE_INET_CSUM -DMODULE_IPV6_ADDR -DMODULE_IPV6_HDR -DMODULE_NATIVE_DRIVERS -DMODULE_PERIPH -DMODULE_PRNG_TINYMT32 -DMODULE_RANDOM -DMODULE_SYS -DMODULE_TINYMT32 -DMODULE_UDP -DMODULE_XTIMER -DRIOT_VERSION="1d3a-vm" */
+#define DEBUG_ASSERT_VERBOSE 1
+#define BOARD_NATIVE "native"
+#define RIOT_BOARD BOARD_NATIVE
+#define CPU_NATIVE "native"
+#define RIOT_CPU CPU_NATIVE
+#define MCU_NATIVE "native"
+#define RIOT_MCU MCU_NATIVE
+#define NDEBUG 1
+#define SOCK_HAS_IPV6 1
+#define FEATURE_PERIPH_TIMER 1
+#define MODULE_AUTO_INIT 1
+#define MODULE_BITFIELD 1
+#define MODULE_BOARD 1
+#define MODULE_CORE 1
+#define MODULE_CORE_MBOX 1
+#define MODULE_CORE_MSG 1
+#define MODULE_CPU 1
+#define MODULE_DIV 1
+#define MODULE_GNRC 1
+#define MODULE_GNRC_ICMPV6 1
+#define MODULE_GNRC_IPV6 1
+#define MODULE_GNRC_IPV6_DEFAULT 1
+#define MODULE_GNRC_IPV6_DST_CACHE 1
+#define MODULE_GNRC_IPV6_HDR 1
+#define MODULE_GNRC_IPV6_NC 1
+#define MODULE_GNRC_IPV6_NETIF 1
+#define MODULE_GNRC_NDP 1
+#define MODULE_GNRC_NDP_HOST 1
+#define MODULE_GNRC_NDP_INTERNAL 1
+#define MODULE_GNRC_NDP_NODE 1
+#define MODULE_GNRC_NETAPI 1
+#define MODULE_GNRC_NETAPI_MBOX 1
+#define MODULE_GNRC_NETIF 1
+#define MODULE_GNRC_NETIF_HDR 1
+#define MODULE_GNRC_NETREG 1
+#define MODULE_GNRC_PKT 1
+#define MODULE_GNRC_PKTBUF 1
+#define MODULE_GNRC_PKTBUF_STATIC 1
+#define MODULE_GNRC_SOCK 1
+#define MODULE_GNRC_SOCK_UDP 1
+#define MODULE_GNRC_UDP 1
+#define MODULE_INET_CSUM 1
+#define MODULE_IPV6_ADDR 1
+#define MODULE_IPV6_HDR 1
+#define MODULE_NATIVE_DRIVERS 1
+#define MODULE_PERIPH 1
+#define MODULE_PRNG_TINYMT32 1
+#define MODULE_RANDOM 1
+#define MODULE_SYS 1
+#define MODULE_TINYMT32 1
+#define MODULE_UDP 1
+#define MODULE_XTIMER 1
+#define RIOT_VERSION "1d3a-vm"
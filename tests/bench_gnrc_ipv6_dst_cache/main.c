@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the rate gnrc_ipv6 sends packets of a single flow at
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nc.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/netif.h"
+#include "net/sock/udp.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define PORT            (4711U)
+#define PAYLOAD_LEN     (16U)
+#define DURATION        (2U * SEC_IN_USEC)
+#define TIMEOUT         (100U * MS_IN_USEC)
+#define MAIN_QUEUE_SIZE     (4U)
+#define NETIF_QUEUE_SIZE    (8U)
+
+static const uint8_t l2addr[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 };
+static char netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t main_queue[MAIN_QUEUE_SIZE];
+static msg_t netif_queue[NETIF_QUEUE_SIZE];
+static kernel_pid_t main_pid;
+static uint8_t payload[PAYLOAD_LEN];
+static sock_udp_t client;
+
+/* drops everything sent over it and acknowledges UDP packets to main */
+static void *_netif_thread(void *arg)
+{
+    msg_t msg, reply = { .type = GNRC_NETAPI_MSG_TYPE_ACK };
+
+    (void)arg;
+    msg_init_queue(netif_queue, NETIF_QUEUE_SIZE);
+    while (1) {
+        msg_receive(&msg);
+        switch (msg.type) {
+            case GNRC_NETAPI_MSG_TYPE_SND:
+                if (gnrc_pktsnip_search_type(msg.content.ptr,
+                                             GNRC_NETTYPE_UDP) != NULL) {
+                    msg_t ack = { .type = 0 };
+
+                    msg_send(&ack, main_pid);
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+            case GNRC_NETAPI_MSG_TYPE_GET:
+            case GNRC_NETAPI_MSG_TYPE_SET:
+                reply.content.value = (uint32_t)(-ENOTSUP);
+                msg_reply(&msg, &reply);
+                break;
+            default:
+                break;
+        }
+    }
+    return NULL;
+}
+
+static int _init_netif(sock_udp_ep_t *remote)
+{
+    kernel_pid_t netif;
+    ipv6_addr_t addr = { .u8 = { 0xfd, 0x01 } };
+
+    netif = thread_create(netif_stack, sizeof(netif_stack),
+                          THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                          _netif_thread, NULL, "dummy netif");
+    if ((netif <= KERNEL_PID_UNDEF) || (gnrc_netif_add(netif) < 0)) {
+        return -1;
+    }
+    gnrc_ipv6_netif_add(netif);
+    addr.u8[15] = 0x01;
+    if (gnrc_ipv6_netif_add_addr(netif, &addr, 64,
+                                 GNRC_IPV6_NETIF_ADDR_FLAGS_UNICAST) == NULL) {
+        return -1;
+    }
+    addr.u8[15] = 0x02;
+    if (gnrc_ipv6_nc_add(netif, &addr, l2addr, sizeof(l2addr), 0) == NULL) {
+        return -1;
+    }
+    memcpy(remote->addr.ipv6, &addr, sizeof(addr));
+    return 0;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = SOCK_IPV6_EP_ANY;
+    uint32_t start, duration, packets = 0;
+
+#ifdef MODULE_GNRC_IPV6_DST_CACHE
+    puts("gnrc_ipv6 send benchmark (destination cache: on)");
+#else
+    puts("gnrc_ipv6 send benchmark (destination cache: off)");
+#endif
+
+    main_pid = thread_getpid();
+    msg_init_queue(main_queue, MAIN_QUEUE_SIZE);
+    if (_init_netif(&remote) < 0) {
+        puts("unable to set up dummy interface");
+        puts("[FAILURE]");
+        return 1;
+    }
+    local.port = PORT + 1;
+    remote.port = PORT;
+    if (sock_udp_create(&client, &local, NULL, 0) < 0) {
+        puts("unable to create client sock");
+        puts("[FAILURE]");
+        return 1;
+    }
+
+    start = xtimer_now_usec();
+    do {
+        msg_t ack;
+
+        payload[0] = (uint8_t)packets;
+        if ((sock_udp_send(&client, payload, sizeof(payload),
+                           &remote) != sizeof(payload)) ||
+            (xtimer_msg_receive_timeout(&ack, TIMEOUT) < 0)) {
+            puts("packet was not sent");
+            puts("[FAILURE]");
+            return 1;
+        }
+        packets++;
+        duration = xtimer_now_usec() - start;
+    } while (duration < DURATION);
+
+    printf("%" PRIu32 " packets/s\n",
+           (uint32_t)(((uint64_t)packets * SEC_IN_USEC) / duration));
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the round trip rate to a local UDP echo server
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define PORT            (4711U)
+#define DURATION        (2U * SEC_IN_USEC)
+#define TIMEOUT         (100U * MS_IN_USEC)
+
+static const size_t sizes[] = { 64, 512, 1024 };
+static char server_stack[THREAD_STACKSIZE_DEFAULT];
+static uint8_t server_buf[1024];
+static uint8_t tx_buf[sizeof(server_buf)];
+static uint8_t rx_buf[sizeof(server_buf)];
+static sock_udp_t server, client;
+
+static void *_server_thread(void *arg)
+{
+    (void)arg;
+    while (1) {
+        sock_udp_ep_t remote;
+        ssize_t res = sock_udp_recv(&server, server_buf, sizeof(server_buf),
+                                    SOCK_NO_TIMEOUT, &remote);
+
+        if (res >= 0) {
+            sock_udp_send(&server, server_buf, res, &remote);
+        }
+    }
+    return NULL;
+}
+
+static int _run(size_t size)
+{
+    sock_udp_ep_t remote = SOCK_IPV6_EP_ANY;
+    uint32_t start, duration, round_trips = 0;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    remote.port = PORT;
+
+    start = xtimer_now_usec();
+    do {
+        tx_buf[0] = (uint8_t)round_trips;
+        if (sock_udp_send(&client, tx_buf, size, &remote) != (ssize_t)size) {
+            printf("%u byte: unable to send\n", (unsigned)size);
+            return 0;
+        }
+        if ((sock_udp_recv(&client, rx_buf, sizeof(rx_buf), TIMEOUT,
+                           NULL) != (ssize_t)size) ||
+            (memcmp(rx_buf, tx_buf, size) != 0)) {
+            printf("%u byte: received unexpected echo\n", (unsigned)size);
+            return 0;
+        }
+        round_trips++;
+        duration = xtimer_now_usec() - start;
+    } while (duration < DURATION);
+
+    printf("%u byte: %" PRIu32 " round trips/s\n", (unsigned)size,
+           (uint32_t)(((uint64_t)round_trips * SEC_IN_USEC) / duration));
+    return 1;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+#ifdef MODULE_GNRC_IPV6_LOOPBACK_ZEROCOPY
+    puts("gnrc_ipv6 loopback benchmark (zero-copy: on)");
+#else
+    puts("gnrc_ipv6 loopback benchmark (zero-copy: off)");
+#endif
+
+    for (unsigned i = 0; i < sizeof(tx_buf); i++) {
+        tx_buf[i] = (uint8_t)(i * 7);
+    }
+    local.port = PORT;
+    if (sock_udp_create(&server, &local, NULL, 0) < 0) {
+        puts("unable to create server sock");
+        puts("[FAILURE]");
+        return 1;
+    }
+    local.port = PORT + 1;
+    if (sock_udp_create(&client, &local, NULL, 0) < 0) {
+        puts("unable to create client sock");
+        puts("[FAILURE]");
+        return 1;
+    }
+    thread_create(server_stack, sizeof(server_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _server_thread, NULL, "echo server");
+
+    for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        if (!_run(sizes[i])) {
+            puts("[FAILURE]");
+            return 1;
+        }
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the lookup rate of gnrc_netreg with many entries
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define ENTRIES_MAX     (64U)
+#define LOOKUPS         (100000UL)
+#define FIRST_PORT      (1024U)
+#define MAIN_QUEUE_SIZE (4U)
+
+static const unsigned numofs[] = { 1, 16, ENTRIES_MAX };
+static gnrc_netreg_entry_t entries[ENTRIES_MAX];
+static msg_t main_queue[MAIN_QUEUE_SIZE];
+
+static int _run(unsigned numof)
+{
+    uint32_t start, duration;
+    int num = 0;
+
+    gnrc_netreg_init();
+    for (unsigned i = 0; i < numof; i++) {
+        /* ports of a busy UDP node */
+        gnrc_netreg_entry_init_pid(&entries[i], FIRST_PORT + i,
+                                   thread_getpid());
+        if (gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[i]) != 0) {
+            printf("%2u entries: unable to register\n", numof);
+            return 0;
+        }
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        if ((gnrc_netreg_lookup_num(GNRC_NETTYPE_TEST, FIRST_PORT + i,
+                                    &num) != &entries[i]) || (num != 1)) {
+            printf("%2u entries: lookup returned wrong entry\n", numof);
+            return 0;
+        }
+    }
+
+    start = xtimer_now_usec();
+    for (unsigned long i = 0; i < LOOKUPS; i++) {
+        /* the first registered entry is the last in a linear list */
+        gnrc_netreg_lookup_num(GNRC_NETTYPE_TEST, FIRST_PORT, &num);
+    }
+    duration = xtimer_now_usec() - start;
+
+    printf("%2u entries: %" PRIu32 " lookups/s\n", numof,
+           (uint32_t)(((uint64_t)LOOKUPS * SEC_IN_USEC) / duration));
+    return 1;
+}
+
+int main(void)
+{
+#ifdef MODULE_GNRC_NETREG_HASH
+    puts("gnrc_netreg lookup benchmark (hash: on)");
+#else
+    puts("gnrc_netreg lookup benchmark (hash: off)");
+#endif
+
+    /* only threads with a message queue may register */
+    msg_init_queue(main_queue, MAIN_QUEUE_SIZE);
+    for (unsigned i = 0; i < sizeof(numofs) / sizeof(numofs[0]); i++) {
+        if (!_run(numofs[i])) {
+            puts("[FAILURE]");
+            return 1;
+        }
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
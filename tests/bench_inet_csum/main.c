@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the throughput of inet_csum() against a byte-wise loop
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/inet_csum.h"
+#include "xtimer.h"
+
+#define BUF_SIZE        (1280U)     /**< IPv6 minimum MTU */
+#define ROUNDS          (1000U)
+
+static uint8_t _buf[BUF_SIZE + 1];
+
+/* one 16-bit word per iteration, as inet_csum_slice() did originally */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (int i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static uint32_t _run(uint16_t (*csum)(uint16_t, const uint8_t *, uint16_t, size_t),
+                     unsigned offset, uint16_t *sum)
+{
+    uint32_t start = xtimer_now_usec(), duration;
+
+    *sum = 0;
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        /* chain the results, so the compiler can not drop the loop */
+        *sum = csum(*sum, _buf + offset, BUF_SIZE, 0);
+    }
+    duration = xtimer_now_usec() - start;
+    return (duration) ? duration : 1;
+}
+
+static uint32_t _rate(uint32_t duration)
+{
+    return (uint32_t)(((uint64_t)ROUNDS * BUF_SIZE * SEC_IN_USEC) /
+                      (1024 * (uint64_t)duration));
+}
+
+int main(void)
+{
+    puts("inet_csum benchmark");
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = (uint8_t)((i * 7) + (i >> 8));
+    }
+    /* aligned and unaligned buffers */
+    for (unsigned offset = 0; offset < 2; offset++) {
+        uint16_t ref_sum, sum;
+        uint32_t ref = _run(_ref_csum_slice, offset, &ref_sum);
+        uint32_t fast = _run(inet_csum_slice, offset, &sum);
+
+        if (sum != ref_sum) {
+            printf("offset %u: checksums differ (0x%04x != 0x%04x)\n",
+                   offset, sum, ref_sum);
+            puts("[FAILURE]");
+            return 1;
+        }
+        printf("offset %u: %" PRIu32 " KiB/s, byte-wise: %" PRIu32 " KiB/s\n",
+               offset, _rate(fast), _rate(ref));
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
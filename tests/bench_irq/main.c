@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the cost of interrupt masking and the kernel primitives
+ *          built on it
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define ITERATIONS      (100000U)
+#define DEFER_TIMEOUT   (1000U)
+#define DEFER_SPIN      (5000U)
+
+static char stack[THREAD_STACKSIZE_MAIN];
+static mutex_t mutex = MUTEX_INIT;
+static volatile int fired;
+
+static void *_replier(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    while (1) {
+        msg_receive(&msg);
+        msg_reply(&msg, &msg);
+    }
+    return NULL;
+}
+
+static void _fire(void *arg)
+{
+    (void)arg;
+    fired = 1;
+}
+
+static int _deferred_irq(void)
+{
+    xtimer_t timer = { .callback = _fire };
+    uint32_t start;
+
+    xtimer_set(&timer, DEFER_TIMEOUT);
+    unsigned state = irq_disable();
+    start = xtimer_now_usec();
+    while ((xtimer_now_usec() - start) < DEFER_SPIN) {}
+    int early = fired;
+    irq_restore(state);
+
+    /* the timer expired while interrupts were disabled, so its callback
+     * must only run once they are restored */
+    return !early && fired;
+}
+
+static void _result(const char *name, uint32_t duration)
+{
+    printf("%s: %" PRIu32 " ns/op\n", name,
+           (uint32_t)(((uint64_t)duration * 1000) / ITERATIONS));
+}
+
+int main(void)
+{
+    kernel_pid_t pid;
+    uint32_t start;
+    msg_t msg;
+
+#ifdef MODULE_NATIVE_VIRTUAL_IRQ
+    puts("IRQ benchmark (native virtual IRQ: on)");
+#else
+    puts("IRQ benchmark");
+#endif
+
+    if (!_deferred_irq()) {
+        puts("deferred interrupt: FAILED");
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("deferred interrupt: OK");
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        unsigned state = irq_disable();
+        irq_restore(state);
+    }
+    _result("irq_disable/irq_restore", xtimer_now_usec() - start);
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        mutex_lock(&mutex);
+        mutex_unlock(&mutex);
+    }
+    _result("mutex_lock/mutex_unlock", xtimer_now_usec() - start);
+
+    pid = thread_create(stack, sizeof(stack), THREAD_PRIORITY_MAIN - 1,
+                        THREAD_CREATE_STACKTEST, _replier, NULL, "replier");
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        msg.content.value = i;
+        msg_send_receive(&msg, &msg, pid);
+    }
+    _result("msg_send_receive", xtimer_now_usec() - start);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
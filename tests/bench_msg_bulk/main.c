@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the message rate of single and bulk messaging
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define MESSAGES        (100000U)
+#define QUEUE_SIZE      (16U)
+#define BULK_SIZE       (8U)
+#define MSG_TYPE_DATA   (0x4242)
+#define MSG_TYPE_STOP   (0x4243)
+
+static char recv_stack[THREAD_STACKSIZE_MAIN];
+static msg_t recv_queue[QUEUE_SIZE];
+static kernel_pid_t main_pid, recv_pid;
+static bool bulk_recv, bulk_send;
+
+static void *_receiver(void *arg)
+{
+    msg_t msgs[BULK_SIZE];
+    uint32_t expected = 0;
+    bool in_order = true;
+
+    (void)arg;
+    msg_init_queue(recv_queue, QUEUE_SIZE);
+    while (1) {
+        int num = (bulk_recv) ? msg_receive_bulk(msgs, BULK_SIZE)
+                              : msg_receive(msgs);
+
+        for (int i = 0; i < num; i++) {
+            if (msgs[i].type == MSG_TYPE_STOP) {
+                msg_t done = { .content = { .value = in_order &&
+                                            (expected == MESSAGES) } };
+
+                msg_send(&done, main_pid);
+                expected = 0;
+                in_order = true;
+                break;
+            }
+            in_order = in_order && (msgs[i].content.value == expected);
+            expected++;
+        }
+    }
+    return NULL;
+}
+
+static void _send(msg_t *msgs, unsigned num, kernel_pid_t pid)
+{
+    if (bulk_send) {
+        int sent = msg_send_bulk(msgs, num, pid);
+
+        /* block on the first message that did not fit so the receiver
+         * catches up */
+        for (unsigned i = (unsigned)sent; i < num; i++) {
+            msg_send(&msgs[i], pid);
+        }
+    }
+    else {
+        for (unsigned i = 0; i < num; i++) {
+            msg_send(&msgs[i], pid);
+        }
+    }
+}
+
+static int _run(const char *name)
+{
+    msg_t msgs[BULK_SIZE], done;
+    uint32_t start, duration;
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < MESSAGES; i += BULK_SIZE) {
+        for (unsigned j = 0; j < BULK_SIZE; j++) {
+            msgs[j].type = MSG_TYPE_DATA;
+            msgs[j].content.value = i + j;
+        }
+        _send(msgs, BULK_SIZE, recv_pid);
+    }
+    msgs[0].type = MSG_TYPE_STOP;
+    _send(msgs, 1, recv_pid);
+    msg_receive(&done);
+    duration = xtimer_now_usec() - start;
+
+    if (!done.content.value) {
+        printf("%s: messages lost or out of order\n", name);
+        return 0;
+    }
+    printf("%s: %" PRIu32 " msgs/s\n", name,
+           (uint32_t)(((uint64_t)MESSAGES * SEC_IN_USEC) / duration));
+    return 1;
+}
+
+int main(void)
+{
+    puts("msg bulk benchmark");
+
+    main_pid = thread_getpid();
+    /* lower priority, so messages pile up in its queue */
+    recv_pid = thread_create(recv_stack, sizeof(recv_stack),
+                             THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                             _receiver, NULL, "receiver");
+    bulk_send = false;
+    bulk_recv = false;
+    if (!_run("msg_send/msg_receive")) {
+        puts("[FAILURE]");
+        return 1;
+    }
+    bulk_recv = true;
+    if (!_run("msg_send/msg_receive_bulk")) {
+        puts("[FAILURE]");
+        return 1;
+    }
+    bulk_send = true;
+    if (!_run("msg_send_bulk/msg_receive_bulk")) {
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the cost of context switches between two threads
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define ITERATIONS      (100000U)
+#define SLEEP           (1000U)
+
+static char pong_stack[THREAD_STACKSIZE_MAIN];
+static char yield_stack[THREAD_STACKSIZE_MAIN];
+static volatile unsigned yields;
+static volatile int done;
+
+static void *_pong(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    while (1) {
+        msg_receive(&msg);
+        msg.content.value++;
+        msg_reply(&msg, &msg);
+    }
+    return NULL;
+}
+
+static void *_yielder(void *arg)
+{
+    (void)arg;
+    while (!done) {
+        yields++;
+        thread_yield();
+    }
+    return NULL;
+}
+
+static void _result(const char *name, uint32_t duration)
+{
+    printf("%s: %" PRIu32 " ns/op\n", name,
+           (uint32_t)(((uint64_t)duration * 1000) / ITERATIONS));
+}
+
+int main(void)
+{
+    kernel_pid_t pid;
+    uint32_t start;
+    msg_t msg;
+
+#ifdef MODULE_NATIVE_ASM_CONTEXT
+    puts("Context switch benchmark (native asm context: on)");
+#else
+    puts("Context switch benchmark");
+#endif
+
+    /* ping-pong with a thread of higher priority, as examples/ipc_pingpong */
+    pid = thread_create(pong_stack, sizeof(pong_stack), THREAD_PRIORITY_MAIN - 1,
+                        THREAD_CREATE_STACKTEST, _pong, NULL, "pong");
+    msg.content.value = 0;
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        msg_send_receive(&msg, &msg, pid);
+    }
+    _result("msg_send_receive", xtimer_now_usec() - start);
+    if (msg.content.value != ITERATIONS) {
+        puts("ping-pong: lost messages");
+        puts("[FAILURE]");
+        return 1;
+    }
+
+    /* yield back and forth with a thread of the same priority */
+    thread_create(yield_stack, sizeof(yield_stack), THREAD_PRIORITY_MAIN,
+                  THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                  _yielder, NULL, "yielder");
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        thread_yield();
+    }
+    _result("thread_yield", xtimer_now_usec() - start);
+    done = 1;
+    thread_yield();
+    if (yields != ITERATIONS) {
+        printf("yield: %u instead of %u switches\n", yields, ITERATIONS);
+        puts("[FAILURE]");
+        return 1;
+    }
+
+    /* threads must also be resumed from interrupt context */
+    start = xtimer_now_usec();
+    xtimer_usleep(SLEEP);
+    if ((xtimer_now_usec() - start) < SLEEP) {
+        puts("sleep: woke up early");
+        puts("[FAILURE]");
+        return 1;
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the throughput of ringbuffer and tsrb
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ringbuffer.h"
+#include "tsrb.h"
+#include "xtimer.h"
+
+#define BUF_SIZE        (256U)
+#define CHUNK_SIZE      (64U)
+#define TOTAL           (256UL * 1024UL)
+
+/* the pattern repeats every BUF_SIZE bytes, so (src + (pos % BUF_SIZE)) holds
+ * at least BUF_SIZE bytes of it */
+static char src[2 * BUF_SIZE];
+static char dst[CHUNK_SIZE];
+static char rb_buf[BUF_SIZE];
+static char tsrb_buf[BUF_SIZE];
+static ringbuffer_t rb;
+static tsrb_t tsrb;
+static uint32_t produced, consumed;
+
+static inline const char *_src(uint32_t pos)
+{
+    return &src[pos % BUF_SIZE];
+}
+
+static int _check(const char *data, unsigned n)
+{
+    if (memcmp(data, _src(consumed), n) != 0) {
+        return 0;
+    }
+    consumed += n;
+    return 1;
+}
+
+static int _rb_byte(void)
+{
+    int c;
+
+    for (unsigned i = 0; (i < CHUNK_SIZE) && !ringbuffer_full(&rb); i++) {
+        ringbuffer_add_one(&rb, *_src(produced++));
+    }
+    while ((c = ringbuffer_get_one(&rb)) >= 0) {
+        if ((char)c != *_src(consumed++)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int _rb_bulk(void)
+{
+    produced += ringbuffer_add(&rb, _src(produced), CHUNK_SIZE);
+    return _check(dst, ringbuffer_get(&rb, dst, CHUNK_SIZE));
+}
+
+static int _rb_region(void)
+{
+    char *region;
+    unsigned n;
+
+    n = ringbuffer_add_region(&rb, &region);
+    n = (n < CHUNK_SIZE) ? n : CHUNK_SIZE;
+    memcpy(region, _src(produced), n);
+    ringbuffer_add_commit(&rb, n);
+    produced += n;
+
+    n = ringbuffer_get_region(&rb, &region);
+    n = (n < CHUNK_SIZE) ? n : CHUNK_SIZE;
+    if (!_check(region, n)) {
+        return 0;
+    }
+    ringbuffer_get_commit(&rb, n);
+    return 1;
+}
+
+static int _tsrb_byte(void)
+{
+    int c;
+
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        if (tsrb_add_one(&tsrb, *_src(produced)) < 0) {
+            break;
+        }
+        produced++;
+    }
+    while ((c = tsrb_get_one(&tsrb)) != -1) {
+        if ((char)c != *_src(consumed++)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int _tsrb_bulk(void)
+{
+    produced += tsrb_add(&tsrb, _src(produced), CHUNK_SIZE);
+    return _check(dst, tsrb_get(&tsrb, dst, CHUNK_SIZE));
+}
+
+static int _tsrb_region(void)
+{
+    char *region;
+    size_t n;
+
+    n = tsrb_add_region(&tsrb, &region);
+    n = (n < CHUNK_SIZE) ? n : CHUNK_SIZE;
+    memcpy(region, _src(produced), n);
+    tsrb_add_commit(&tsrb, n);
+    produced += n;
+
+    n = tsrb_get_region(&tsrb, &region);
+    n = (n < CHUNK_SIZE) ? n : CHUNK_SIZE;
+    if (!_check(region, n)) {
+        return 0;
+    }
+    tsrb_get_commit(&tsrb, n);
+    return 1;
+}
+
+static int _run(const char *name, int (*round)(void))
+{
+    uint32_t start, duration;
+
+    ringbuffer_init(&rb, rb_buf, sizeof(rb_buf));
+    tsrb_init(&tsrb, tsrb_buf, sizeof(tsrb_buf));
+    produced = 0;
+    consumed = 0;
+
+    start = xtimer_now_usec();
+    while (consumed < TOTAL) {
+        if (!round()) {
+            printf("%s: data out of order\n", name);
+            return 0;
+        }
+    }
+    duration = xtimer_now_usec() - start;
+
+    printf("%s: %" PRIu32 " bytes/s\n", name,
+           (uint32_t)(((uint64_t)consumed * SEC_IN_USEC) / duration));
+    return 1;
+}
+
+int main(void)
+{
+    puts("ringbuffer/tsrb benchmark");
+
+    for (unsigned i = 0; i < sizeof(src); i++) {
+        src[i] = (char)((i % BUF_SIZE) * 7);
+    }
+    if (!_run("ringbuffer byte", _rb_byte) ||
+        !_run("ringbuffer bulk", _rb_bulk) ||
+        !_run("ringbuffer region", _rb_region) ||
+        !_run("tsrb byte", _tsrb_byte) ||
+        !_run("tsrb bulk", _tsrb_bulk) ||
+        !_run("tsrb region", _tsrb_region)) {
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
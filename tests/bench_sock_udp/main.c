@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the UDP throughput of sock over the IPv6 loopback
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "xtimer.h"
+
+#define PORT            (4711U)
+#define DURATION        (2U * SEC_IN_USEC)
+#define TIMEOUT         (100U * MS_IN_USEC)
+
+/* odd sizes leave a single byte at the end of the summed payload */
+static const size_t sizes[] = { 64, 65, 512, 513, 1023, 1024 };
+static uint8_t tx_buf[1024];
+static uint8_t rx_buf[sizeof(tx_buf)];
+static sock_udp_t server, client;
+
+static int _run(size_t size)
+{
+    sock_udp_ep_t remote = SOCK_IPV6_EP_ANY;
+    uint32_t start, duration, packets = 0;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    remote.port = PORT;
+
+    start = xtimer_now_usec();
+    do {
+        tx_buf[0] = (uint8_t)packets;
+        if (sock_udp_send(&client, tx_buf, size, &remote) != (ssize_t)size) {
+            printf("%u byte: unable to send\n", (unsigned)size);
+            return 0;
+        }
+        if ((sock_udp_recv(&server, rx_buf, sizeof(rx_buf), TIMEOUT,
+                           NULL) != (ssize_t)size) ||
+            (memcmp(rx_buf, tx_buf, size) != 0)) {
+            printf("%u byte: received unexpected data\n", (unsigned)size);
+            return 0;
+        }
+        packets++;
+        duration = xtimer_now_usec() - start;
+    } while (duration < DURATION);
+
+    printf("%u byte: %" PRIu32 " packets/s, %" PRIu32 " bytes/s\n",
+           (unsigned)size, (uint32_t)(((uint64_t)packets * SEC_IN_USEC) / duration),
+           (uint32_t)(((uint64_t)packets * size * SEC_IN_USEC) / duration));
+    return 1;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    puts("sock_udp benchmark (fused copy and checksum: on)");
+#else
+    puts("sock_udp benchmark (fused copy and checksum: off)");
+#endif
+
+    for (unsigned i = 0; i < sizeof(tx_buf); i++) {
+        tx_buf[i] = (uint8_t)(i * 7);
+    }
+    local.port = PORT;
+    if (sock_udp_create(&server, &local, NULL, 0) < 0) {
+        puts("unable to create server sock");
+        puts("[FAILURE]");
+        return 1;
+    }
+    local.port = PORT + 1;
+    if (sock_udp_create(&client, &local, NULL, 0) < 0) {
+        puts("unable to create client sock");
+        puts("[FAILURE]");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        if (!_run(sizes[i])) {
+            puts("[FAILURE]");
+            return 1;
+        }
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures interning existing universal addresses in large tables
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "universal_address.h"
+#include "xtimer.h"
+
+#define ADDR_SIZE       (16U)
+#define OPS             (10000UL)
+
+static void _addr(uint8_t *addr, unsigned i)
+{
+    /* IPv6 like addresses only differing in the last bytes, as in a FIB */
+    memset(addr, 0, ADDR_SIZE);
+    addr[0] = 0xfd;
+    addr[11] = 0xff;
+    addr[12] = 0xfe;
+    addr[14] = i >> 8;
+    addr[15] = i & 0xff;
+}
+
+static unsigned _capacity(void)
+{
+    uint8_t addr[ADDR_SIZE];
+    unsigned numof = 0;
+
+    universal_address_init();
+    _addr(addr, numof);
+    while (universal_address_add(addr, sizeof(addr)) != NULL) {
+        _addr(addr, ++numof);
+    }
+    return numof;
+}
+
+static int _run(unsigned numof)
+{
+    uint8_t addr[ADDR_SIZE];
+    universal_address_container_t *entry;
+    uint32_t start, duration;
+
+    universal_address_init();
+    for (unsigned i = 0; i < numof; i++) {
+        _addr(addr, i);
+        if (universal_address_add(addr, sizeof(addr)) == NULL) {
+            printf("%4u entries: unable to add address\n", numof);
+            return 0;
+        }
+    }
+
+    start = xtimer_now_usec();
+    for (unsigned long i = 0; i < OPS; i++) {
+        /* a route update: intern its address and drop the former reference */
+        _addr(addr, (i * 7919) % numof);
+        entry = universal_address_add(addr, sizeof(addr));
+        universal_address_rem(entry);
+    }
+    duration = xtimer_now_usec() - start;
+
+    if (universal_address_get_num_used_entries() != (int)numof) {
+        printf("%4u entries: number of used entries changed\n", numof);
+        return 0;
+    }
+    printf("%4u entries: %" PRIu32 " add/rem/s\n", numof,
+           (uint32_t)(((uint64_t)OPS * SEC_IN_USEC) / duration));
+    return 1;
+}
+
+int main(void)
+{
+    unsigned capacity = _capacity();
+    const unsigned numofs[] = { 16, 256, capacity };
+
+    puts("universal_address add/rem benchmark");
+
+    for (unsigned i = 0; i < sizeof(numofs) / sizeof(numofs[0]); i++) {
+        /* the capacity may coincide with a smaller table */
+        if ((i > 0) && (numofs[i] <= numofs[i - 1])) {
+            break;
+        }
+        if (!_run(numofs[i])) {
+            puts("[FAILURE]");
+            return 1;
+        }
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
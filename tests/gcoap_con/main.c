@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Checks retransmission of confirmable gcoap requests against a
+ *          silent, an acknowledging and a resetting peer
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc/coap.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define PEER_PORT       (GCOAP_PORT + 1)
+#define RESP_ID         (0x4242)
+/* allowed deviation of a measured time from the expected one */
+#define TOLERANCE       (20U * MS_IN_USEC)
+#define MAIN_QUEUE_SIZE (4U)
+
+#define CALL(fn)            puts("Calling " # fn); \
+                            if (!fn) { \
+                                puts("[FAILURE]"); \
+                                return 1; \
+                            }
+
+static msg_t main_queue[MAIN_QUEUE_SIZE];
+static kernel_pid_t main_pid;
+static sock_udp_t peer;
+/* gcoap's endpoint, as seen by the peer */
+static sock_udp_ep_t remote;
+static uint8_t req_buf[GCOAP_PDU_BUF_SIZE];
+static ssize_t req_len;
+static uint8_t peer_buf[GCOAP_PDU_BUF_SIZE];
+
+/* reports the request state and the response code to main */
+static void _resp_handler(unsigned req_state, coap_pkt_t *pdu)
+{
+    msg_t msg;
+
+    msg.type = req_state;
+    /* on timeout or error, pdu holds the request header */
+    msg.content.value = (coap_get_code_class(pdu) * 100) +
+                        coap_get_code_detail(pdu);
+    msg_send(&msg, main_pid);
+}
+
+static bool _send_request(void)
+{
+    ipv6_addr_t addr = IPV6_ADDR_LOOPBACK;
+    coap_pkt_t pdu;
+
+    req_len = gcoap_request(&pdu, req_buf, sizeof(req_buf), COAP_METHOD_GET,
+                            "/con");
+    if (req_len < 0) {
+        puts("unable to build request");
+        return false;
+    }
+    gcoap_hdr_set_type(pdu.hdr, COAP_TYPE_CON);
+    if (gcoap_req_send(req_buf, req_len, &addr, PEER_PORT, _resp_handler) == 0) {
+        puts("unable to send request");
+        return false;
+    }
+    return true;
+}
+
+/* waits up to timeout for the request, as sent by _send_request() */
+static bool _peer_recv_req(uint32_t timeout)
+{
+    ssize_t len = sock_udp_recv(&peer, peer_buf, sizeof(peer_buf), timeout,
+                                &remote);
+
+    return (len == req_len) && (memcmp(peer_buf, req_buf, len) == 0);
+}
+
+static void _peer_send_empty(unsigned type, uint16_t id)
+{
+    coap_hdr_t empty;
+
+    coap_build_hdr(&empty, type, NULL, 0, 0, 0);
+    empty.id = id;
+    sock_udp_send(&peer, &empty, sizeof(empty), &remote);
+}
+
+static bool _wait_handler(uint32_t timeout, msg_t *msg)
+{
+    if (xtimer_msg_receive_timeout(msg, timeout) < 0) {
+        puts("response handler not called");
+        return false;
+    }
+    return true;
+}
+
+/* checks that gap lies within [min, max], give or take TOLERANCE */
+static bool _in_time(const char *what, uint32_t gap, uint32_t min, uint32_t max)
+{
+    if (((gap + TOLERANCE) < min) || (gap > (max + TOLERANCE))) {
+        printf("%s after %" PRIu32 " us, expected %" PRIu32 " to %" PRIu32
+               " us\n", what, gap, min, max);
+        return false;
+    }
+    return true;
+}
+
+/* checks that no request is open and no packet is left over */
+static bool _is_done(void)
+{
+    uint8_t open_reqs;
+
+    if (sock_udp_recv(&peer, peer_buf, sizeof(peer_buf), 0, NULL) >= 0) {
+        puts("unexpected message to peer");
+        return false;
+    }
+    gcoap_op_state(&open_reqs);
+    if (open_reqs) {
+        puts("request still open");
+        return false;
+    }
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("packet buffer not empty");
+        return false;
+    }
+    return true;
+}
+
+static bool test_silent_peer(void)
+{
+    uint32_t last, now, gap = 0;
+    msg_t msg;
+
+    if (!_send_request() || !_peer_recv_req(TOLERANCE)) {
+        puts("request missing");
+        return false;
+    }
+    last = xtimer_now_usec();
+    for (unsigned i = 1; i <= GCOAP_MAX_RETRANSMIT; i++) {
+        uint32_t min = (i == 1) ? GCOAP_ACK_TIMEOUT : (2 * gap);
+        uint32_t max = (i == 1) ? (GCOAP_ACK_TIMEOUT + GCOAP_ACK_TIMEOUT_RANDOM)
+                                : (2 * gap);
+
+        if (!_peer_recv_req(max + TOLERANCE)) {
+            printf("retransmission %u missing\n", i);
+            return false;
+        }
+        now = xtimer_now_usec();
+        gap = now - last;
+        last = now;
+        if (!_in_time("retransmission", gap, min, max)) {
+            return false;
+        }
+    }
+    /* out of retransmissions, the request times out after another doubled
+     * wait */
+    if (!_wait_handler((2 * gap) + TOLERANCE, &msg)) {
+        return false;
+    }
+    if (msg.type != GCOAP_MEMO_TIMEOUT) {
+        printf("unexpected request state %u\n", (unsigned)msg.type);
+        return false;
+    }
+    if (!_in_time("timeout", xtimer_now_usec() - last, 2 * gap, 2 * gap)) {
+        return false;
+    }
+    return _is_done();
+}
+
+static bool test_empty_ack_separate_response(void)
+{
+    uint8_t token[GCOAP_TOKENLEN_MAX];
+    unsigned token_len;
+    coap_hdr_t ack, expected;
+    coap_pkt_t pdu;
+    ssize_t len;
+    msg_t msg;
+
+    if (!_send_request() || !_peer_recv_req(TOLERANCE)) {
+        puts("request missing");
+        return false;
+    }
+    coap_parse(&pdu, peer_buf, req_len);
+    token_len = coap_get_token_len(&pdu);
+    memcpy(token, pdu.token, token_len);
+    /* a server that needs time for the response acknowledges first */
+    _peer_send_empty(COAP_TYPE_ACK, pdu.hdr->id);
+    if (sock_udp_recv(&peer, peer_buf, sizeof(peer_buf),
+                      2 * (GCOAP_ACK_TIMEOUT + GCOAP_ACK_TIMEOUT_RANDOM),
+                      NULL) >= 0) {
+        puts("retransmitted after ACK");
+        return false;
+    }
+    len = coap_build_hdr((coap_hdr_t *)peer_buf, COAP_TYPE_CON, token,
+                         token_len, COAP_CODE_CONTENT, RESP_ID);
+    sock_udp_send(&peer, peer_buf, len, &remote);
+    if (!_wait_handler(TOLERANCE, &msg)) {
+        return false;
+    }
+    if ((msg.type == GCOAP_MEMO_TIMEOUT) || (msg.type == GCOAP_MEMO_ERR) ||
+        (msg.content.value != 205)) {
+        printf("unexpected request state %u, code %" PRIu32 "\n",
+               (unsigned)msg.type, msg.content.value);
+        return false;
+    }
+    /* the separate response is acknowledged with its message ID */
+    coap_build_hdr(&expected, COAP_TYPE_ACK, NULL, 0, 0, 0);
+    expected.id = ((coap_hdr_t *)peer_buf)->id;
+    if ((sock_udp_recv(&peer, &ack, sizeof(ack), TOLERANCE, NULL) != sizeof(ack)) ||
+        (memcmp(&ack, &expected, sizeof(ack)) != 0)) {
+        puts("separate response not acknowledged");
+        return false;
+    }
+    return _is_done();
+}
+
+static bool test_rst(void)
+{
+    msg_t msg;
+
+    if (!_send_request() || !_peer_recv_req(TOLERANCE)) {
+        puts("request missing");
+        return false;
+    }
+    _peer_send_empty(COAP_TYPE_RST, ((coap_hdr_t *)peer_buf)->id);
+    if (!_wait_handler(TOLERANCE, &msg)) {
+        return false;
+    }
+    if (msg.type != GCOAP_MEMO_ERR) {
+        printf("unexpected request state %u\n", (unsigned)msg.type);
+        return false;
+    }
+    if (sock_udp_recv(&peer, peer_buf, sizeof(peer_buf),
+                      GCOAP_ACK_TIMEOUT + GCOAP_ACK_TIMEOUT_RANDOM, NULL) >= 0) {
+        puts("retransmitted after RST");
+        return false;
+    }
+    return _is_done();
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    puts("gcoap confirmable request test");
+
+    main_pid = thread_getpid();
+    msg_init_queue(main_queue, MAIN_QUEUE_SIZE);
+    local.port = PEER_PORT;
+    if (sock_udp_create(&peer, &local, NULL, 0) < 0) {
+        puts("unable to create peer sock");
+        puts("[FAILURE]");
+        return 1;
+    }
+
+    CALL(test_silent_peer());
+    CALL(test_empty_ack_separate_response());
+    CALL(test_rst());
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Checks that neighbor advertisements invalidate the IPv6
+ *          destination cache
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "net/icmpv6.h"
+#include "net/ndp.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/dst_cache.h"
+#include "net/gnrc/ipv6/nc.h"
+#include "net/gnrc/ipv6/netif.h"
+#include "net/gnrc/ndp.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+
+#define QUEUE_SIZE      (4U)
+
+#define CALL(fn)            puts("Calling " # fn); \
+                            if (!fn) { \
+                                puts("[FAILURE]"); \
+                                return 1; \
+                            }
+
+static msg_t _main_queue[QUEUE_SIZE];
+static kernel_pid_t _iface;
+
+static const ipv6_addr_t _nbr = { .u8 = { 0xfd, 0x01, 0, 0, 0, 0, 0, 0,
+                                          0, 0, 0, 0, 0, 0, 0, 0x02 } };
+static const ipv6_addr_t _own = { .u8 = { 0xfd, 0x01, 0, 0, 0, 0, 0, 0,
+                                          0, 0, 0, 0, 0, 0, 0, 0x01 } };
+static uint8_t _nbr_l2[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 };
+static uint8_t _new_nbr_l2[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x03 };
+static uint8_t _own_l2[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 };
+
+/* adds a reachable neighbor and caches it as destination */
+static bool _set_up(uint8_t flags)
+{
+    gnrc_ipv6_dst_cache_t *entry;
+
+    if (gnrc_ipv6_nc_add(_iface, &_nbr, _nbr_l2, sizeof(_nbr_l2),
+                         GNRC_IPV6_NC_STATE_REACHABLE | flags) == NULL) {
+        puts("unable to add neighbor");
+        return false;
+    }
+    gnrc_ipv6_dst_cache_add(gnrc_ipv6_dst_cache_gen(), KERNEL_PID_UNDEF, &_nbr,
+                            _iface, _nbr_l2, sizeof(_nbr_l2), &_own);
+    entry = gnrc_ipv6_dst_cache_get(KERNEL_PID_UNDEF, &_nbr);
+    if ((entry == NULL) || (entry->l2addr_len != sizeof(_nbr_l2)) ||
+        (memcmp(entry->l2addr, _nbr_l2, sizeof(_nbr_l2)) != 0)) {
+        puts("destination was not cached");
+        return false;
+    }
+    return true;
+}
+
+static void _tear_down(void)
+{
+    gnrc_ipv6_nc_remove(_iface, &_nbr);
+}
+
+/* hands a neighbor advertisement for _nbr over to NDP as if it was received */
+static bool _recv_nbr_adv(uint8_t flags, const uint8_t *l2addr)
+{
+    gnrc_pktsnip_t *netif, *ipv6, *icmpv6;
+    ndp_nbr_adv_t *nbr_adv;
+    ndp_opt_t *tl2a;
+
+    netif = gnrc_netif_hdr_build(_nbr_l2, sizeof(_nbr_l2), _own_l2,
+                                 sizeof(_own_l2));
+    if (netif == NULL) {
+        return false;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _iface;
+    ipv6 = gnrc_ipv6_hdr_build(netif, &_nbr, &_own);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(netif);
+        return false;
+    }
+    ((ipv6_hdr_t *)ipv6->data)->hl = 255;
+    /* the option is 8 byte aligned: 2 byte header + 8 byte address */
+    icmpv6 = gnrc_pktbuf_add(ipv6, NULL, sizeof(ndp_nbr_adv_t) + 16U,
+                             GNRC_NETTYPE_ICMPV6);
+    if (icmpv6 == NULL) {
+        gnrc_pktbuf_release(ipv6);
+        return false;
+    }
+    memset(icmpv6->data, 0, icmpv6->size);
+    nbr_adv = icmpv6->data;
+    nbr_adv->type = ICMPV6_NBR_ADV;
+    nbr_adv->flags = flags;
+    memcpy(&nbr_adv->tgt, &_nbr, sizeof(nbr_adv->tgt));
+    tl2a = (ndp_opt_t *)(nbr_adv + 1);
+    tl2a->type = NDP_OPT_TL2A;
+    tl2a->len = 2;
+    memcpy(tl2a + 1, l2addr, sizeof(_nbr_l2));
+    gnrc_ndp_nbr_adv_handle(_iface, icmpv6, ipv6->data, nbr_adv, icmpv6->size);
+    gnrc_pktbuf_release(icmpv6);
+    return true;
+}
+
+static bool test_override_new_l2addr(void)
+{
+    gnrc_ipv6_nc_t *nc_entry;
+    bool res = false;
+
+    if (!_set_up(0) ||
+        !_recv_nbr_adv(NDP_NBR_ADV_FLAGS_O, _new_nbr_l2)) {
+        goto out;
+    }
+    nc_entry = gnrc_ipv6_nc_get(_iface, &_nbr);
+    if ((nc_entry == NULL) ||
+        (memcmp(nc_entry->l2_addr, _new_nbr_l2, sizeof(_new_nbr_l2)) != 0)) {
+        puts("neighbor cache was not updated");
+        goto out;
+    }
+    if (gnrc_ipv6_dst_cache_get(KERNEL_PID_UNDEF, &_nbr) != NULL) {
+        puts("destination cache still has the old link-layer address");
+        goto out;
+    }
+    res = true;
+out:
+    _tear_down();
+    return res;
+}
+
+static bool test_override_not_router(void)
+{
+    gnrc_ipv6_nc_t *nc_entry;
+    bool res = false;
+
+    if (!_set_up(GNRC_IPV6_NC_IS_ROUTER) ||
+        !_recv_nbr_adv(NDP_NBR_ADV_FLAGS_O, _nbr_l2)) {
+        goto out;
+    }
+    nc_entry = gnrc_ipv6_nc_get(_iface, &_nbr);
+    if ((nc_entry == NULL) || (nc_entry->flags & GNRC_IPV6_NC_IS_ROUTER)) {
+        puts("neighbor cache was not updated");
+        goto out;
+    }
+    if (gnrc_ipv6_dst_cache_get(KERNEL_PID_UNDEF, &_nbr) != NULL) {
+        puts("destination cache still has the neighbor as router");
+        goto out;
+    }
+    res = true;
+out:
+    _tear_down();
+    return res;
+}
+
+int main(void)
+{
+    puts("IPv6 destination cache test");
+
+    msg_init_queue(_main_queue, QUEUE_SIZE);
+    /* nothing is sent over the interface, so the main thread can stand in
+     * for it */
+    _iface = thread_getpid();
+    gnrc_ipv6_netif_add(_iface);
+
+    CALL(test_override_new_l2addr());
+    CALL(test_override_not_router());
+
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("packet buffer not empty");
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares serial option requests against gnrc_netapi_opts()
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/eui64.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/nettype.h"
+#include "xtimer.h"
+
+#define ROUNDS      (1000U)
+
+/**
+ * @brief   Options requested by gnrc_ipv6_netif_init_by_dev() and ifconfig
+ */
+static const struct {
+    netopt_t opt;
+    uint16_t len;
+} _opts[] = {
+    { NETOPT_ADDRESS, 8 },
+    { NETOPT_ADDRESS_LONG, 8 },
+    { NETOPT_SRC_LEN, sizeof(uint16_t) },
+    { NETOPT_MAX_PACKET_SIZE, sizeof(uint16_t) },
+    { NETOPT_IPV6_IID, sizeof(eui64_t) },
+    { NETOPT_IS_WIRED, 0 },
+    { NETOPT_PROTO, sizeof(gnrc_nettype_t) },
+    { NETOPT_CHANNEL, sizeof(uint16_t) },
+    { NETOPT_NID, sizeof(uint16_t) },
+    { NETOPT_TX_POWER, sizeof(int16_t) },
+    { NETOPT_STATE, sizeof(netopt_state_t) },
+    { NETOPT_PROMISCUOUSMODE, sizeof(netopt_enable_t) },
+    { NETOPT_AUTOACK, sizeof(netopt_enable_t) },
+    { NETOPT_CSMA, sizeof(netopt_enable_t) },
+    { NETOPT_RAWMODE, sizeof(netopt_enable_t) },
+};
+
+#define OPTS_NUMOF  (sizeof(_opts) / sizeof(_opts[0]))
+
+typedef union {
+    uint8_t u8[8];
+    uint16_t u16;
+    eui64_t eui64;
+    gnrc_nettype_t type;
+    netopt_state_t state;
+    netopt_enable_t enable;
+} _buf_t;
+
+static _buf_t _serial_bufs[OPTS_NUMOF], _batched_bufs[OPTS_NUMOF];
+static int _serial_res[OPTS_NUMOF];
+static gnrc_netapi_opt_req_t _reqs[OPTS_NUMOF];
+
+static void _serial(kernel_pid_t iface)
+{
+    for (unsigned i = 0; i < OPTS_NUMOF; i++) {
+        _serial_res[i] = gnrc_netapi_get(iface, _opts[i].opt, 0,
+                                         &_serial_bufs[i], _opts[i].len);
+    }
+}
+
+static void _batched(kernel_pid_t iface)
+{
+    gnrc_netapi_opts(iface, _reqs, OPTS_NUMOF);
+}
+
+static uint32_t _bench(void (*fn)(kernel_pid_t), kernel_pid_t iface)
+{
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        fn(iface);
+    }
+    return xtimer_now_usec() - start;
+}
+
+int main(void)
+{
+    kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+
+    printf("boot: %" PRIu32 " us until main\n", xtimer_now_usec());
+
+    if (gnrc_netif_get(ifs) == 0) {
+        puts("no interface");
+        puts("[FAILURE]");
+        return 1;
+    }
+
+    memset(_serial_bufs, 0, sizeof(_serial_bufs));
+    memset(_batched_bufs, 0, sizeof(_batched_bufs));
+    for (unsigned i = 0; i < OPTS_NUMOF; i++) {
+        _reqs[i].type = GNRC_NETAPI_MSG_TYPE_GET;
+        _reqs[i].opt.opt = _opts[i].opt;
+        _reqs[i].opt.context = 0;
+        _reqs[i].opt.data = &_batched_bufs[i];
+        _reqs[i].opt.data_len = _opts[i].len;
+    }
+
+    /* both ways must yield the same */
+    _serial(ifs[0]);
+    if (gnrc_netapi_opts(ifs[0], _reqs, OPTS_NUMOF) != (int)OPTS_NUMOF) {
+        puts("not all requests processed");
+        puts("[FAILURE]");
+        return 1;
+    }
+    for (unsigned i = 0; i < OPTS_NUMOF; i++) {
+        if ((_reqs[i].res != _serial_res[i]) ||
+            ((_serial_res[i] > 0) && (_opts[i].len > 0) &&
+             (memcmp(&_serial_bufs[i], &_batched_bufs[i], _opts[i].len) != 0))) {
+            printf("option %u: results differ (%d != %d)\n", i, _reqs[i].res,
+                   _serial_res[i]);
+            puts("[FAILURE]");
+            return 1;
+        }
+    }
+
+    /* the timings are informational only, they depend on the host */
+    printf("serial: %" PRIu32 " us for %u rounds of %u options\n",
+           _bench(_serial, ifs[0]), ROUNDS, (unsigned)OPTS_NUMOF);
+    printf("batched: %" PRIu32 " us for %u rounds of %u options\n",
+           _bench(_batched, ifs[0]), ROUNDS, (unsigned)OPTS_NUMOF);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
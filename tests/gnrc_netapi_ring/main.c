@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test for dispatching packets to gnrc_netapi packet rings
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "thread_flags.h"
+
+#define RING_SIZE           (4U)
+#define RING_FLAG           (0x0001)
+#define DEMUX_CTX           (4711U)
+
+#define CALL(fn)            puts("Calling " # fn); \
+                            if (!fn) { \
+                                puts("[FAILURE]"); \
+                                return 1; \
+                            }
+
+#define CHECK(cond)         if (!(cond)) { \
+                                printf("%s:%d: check failed\n", __func__, \
+                                       __LINE__); \
+                                return 0; \
+                            }
+
+static int test_netapi_dispatch__ring(void)
+{
+    msg_t buf[RING_SIZE], msg;
+    gnrc_netapi_ring_t ring;
+    gnrc_netreg_entry_t entry;
+    gnrc_pktsnip_t *pkt;
+    int res;
+
+    gnrc_pktbuf_init();
+    gnrc_netapi_ring_init(&ring, buf, RING_SIZE, RING_FLAG);
+    gnrc_netreg_entry_init_ring(&entry, DEMUX_CTX, &ring);
+    res = gnrc_netreg_register(GNRC_NETTYPE_TEST, &entry);
+    CHECK(res == 0);
+    CHECK(gnrc_netapi_ring_get(&ring, &msg) == 0);
+
+    /* overfill the ring by one */
+    for (unsigned i = 0; i <= RING_SIZE; i++) {
+        pkt = gnrc_pktbuf_add(NULL, NULL, i + 1, GNRC_NETTYPE_TEST);
+        CHECK(pkt != NULL);
+        res = gnrc_netapi_dispatch_receive(GNRC_NETTYPE_TEST, DEMUX_CTX, pkt);
+        CHECK(res == 1);
+    }
+    CHECK(entry.dropped == 1);
+    CHECK(thread_flags_clear(RING_FLAG) == RING_FLAG);
+
+    /* the packets come out in order and the last one was released */
+    for (unsigned i = 0; i < RING_SIZE; i++) {
+        res = gnrc_netapi_ring_get(&ring, &msg);
+        CHECK(res == 1);
+        CHECK(msg.type == GNRC_NETAPI_MSG_TYPE_RCV);
+        pkt = msg.content.ptr;
+        CHECK(pkt->size == i + 1);
+        gnrc_pktbuf_release(pkt);
+    }
+    CHECK(gnrc_netapi_ring_get(&ring, &msg) == 0);
+    CHECK(gnrc_pktbuf_is_empty());
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &entry);
+    return 1;
+}
+
+static int test_netapi_dispatch__ring_fan_out(void)
+{
+    msg_t buf[2][RING_SIZE], msg;
+    gnrc_netapi_ring_t ring[2];
+    gnrc_netreg_entry_t entry[2];
+    gnrc_pktsnip_t *pkt;
+    int res;
+
+    gnrc_pktbuf_init();
+    for (unsigned i = 0; i < 2; i++) {
+        gnrc_netapi_ring_init(&ring[i], buf[i], RING_SIZE, RING_FLAG);
+        gnrc_netreg_entry_init_ring(&entry[i], DEMUX_CTX, &ring[i]);
+        res = gnrc_netreg_register(GNRC_NETTYPE_TEST, &entry[i]);
+        CHECK(res == 0);
+    }
+    pkt = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
+    CHECK(pkt != NULL);
+    res = gnrc_netapi_dispatch_receive(GNRC_NETTYPE_TEST, DEMUX_CTX, pkt);
+    CHECK(res == 2);
+    CHECK(pkt->users == 2);
+    for (unsigned i = 0; i < 2; i++) {
+        res = gnrc_netapi_ring_get(&ring[i], &msg);
+        CHECK(res == 1);
+        CHECK(msg.content.ptr == pkt);
+        CHECK(entry[i].dropped == 0);
+        gnrc_pktbuf_release(msg.content.ptr);
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &entry[i]);
+    }
+    thread_flags_clear(RING_FLAG);
+    CHECK(gnrc_pktbuf_is_empty());
+    return 1;
+}
+
+int main(void)
+{
+    gnrc_netreg_init();
+
+    CALL(test_netapi_dispatch__ring());
+    CALL(test_netapi_dispatch__ring_fan_out());
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test and benchmark for the packet buffer implementations
+ *
+ * Build with `PKTBUF=static` to compare against gnrc_pktbuf_static.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/uio.h>
+
+#include "net/gnrc/pktbuf.h"
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+#include "net/gnrc/pktbuf_slab.h"
+#endif
+#include "xtimer.h"
+
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+#define _MAX_SIZE           (GNRC_PKTBUF_SLAB_LARGE_SIZE)
+#else
+#define _MAX_SIZE           (GNRC_PKTBUF_SIZE)
+#endif
+
+#define BENCH_TIMEOUT_S     (1U)
+#define BENCH_WINDOW        (4U)
+
+#define CALL(fn)            puts("Calling " # fn); \
+                            if (!fn || !tear_down()) { \
+                                puts("[FAILURE]"); \
+                                return 1; \
+                            }
+
+#define CHECK(cond)         if (!(cond)) { \
+                                printf("%s:%d: check failed\n", __func__, \
+                                       __LINE__); \
+                                return 0; \
+                            }
+
+static uint8_t _data[256];
+
+static int tear_down(void)
+{
+    CHECK(gnrc_pktbuf_is_sane());
+    CHECK(gnrc_pktbuf_is_empty());
+    gnrc_pktbuf_init();
+    return 1;
+}
+
+static int test_pktbuf_add__success(void)
+{
+    gnrc_pktsnip_t *pkt1, *pkt2, *pkt3;
+
+    pkt1 = gnrc_pktbuf_add(NULL, _data, 8, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt1 != NULL);
+    pkt2 = gnrc_pktbuf_add(pkt1, _data, 100, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt2 != NULL);
+    pkt3 = gnrc_pktbuf_add(pkt2, NULL, 0, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt3 != NULL);
+    CHECK(pkt3->next == pkt2);
+    CHECK(pkt2->next == pkt1);
+    CHECK(pkt3->data == NULL);
+    CHECK(memcmp(pkt1->data, _data, 8) == 0);
+    CHECK(memcmp(pkt2->data, _data, 100) == 0);
+    CHECK(gnrc_pktbuf_is_sane());
+    CHECK(!gnrc_pktbuf_is_empty());
+    gnrc_pktbuf_release(pkt3);
+    return 1;
+}
+
+static int test_pktbuf_add__too_large(void)
+{
+    CHECK(gnrc_pktbuf_add(NULL, NULL, _MAX_SIZE + 1, GNRC_NETTYPE_UNDEF) == NULL);
+    return 1;
+}
+
+static int test_pktbuf_add__exhausted(void)
+{
+    gnrc_pktsnip_t *pkt = NULL, *tmp;
+    unsigned count = 0;
+
+    while ((tmp = gnrc_pktbuf_add(pkt, NULL, 64, GNRC_NETTYPE_UNDEF)) != NULL) {
+        pkt = tmp;
+        count++;
+    }
+    CHECK(count > 0);
+    CHECK(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    return 1;
+}
+
+static int test_pktbuf_mark__success(void)
+{
+    gnrc_pktsnip_t *pkt, *marked;
+    void *data;
+
+    pkt = gnrc_pktbuf_add(NULL, _data, 100, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt != NULL);
+    data = pkt->data;
+    marked = gnrc_pktbuf_mark(pkt, 40, GNRC_NETTYPE_TEST);
+    CHECK(marked != NULL);
+    CHECK(pkt->next == marked);
+    CHECK(marked->size == 40);
+    CHECK(pkt->size == 60);
+    CHECK(memcmp(marked->data, _data, 40) == 0);
+    CHECK(memcmp(pkt->data, _data + 40, 60) == 0);
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    /* no data was moved */
+    CHECK(marked->data == data);
+    CHECK(pkt->data == ((uint8_t *)data) + 40);
+#else
+    (void)data;
+#endif
+    CHECK(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    return 1;
+}
+
+static int test_pktbuf_mark__release_order(void)
+{
+    gnrc_pktsnip_t *pkt, *marked;
+
+    pkt = gnrc_pktbuf_add(NULL, _data, 100, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt != NULL);
+    marked = gnrc_pktbuf_mark(pkt, 40, GNRC_NETTYPE_TEST);
+    CHECK(marked != NULL);
+    /* release the marked part first, the rest must stay valid */
+    pkt = gnrc_pktbuf_remove_snip(pkt, marked);
+    CHECK(gnrc_pktbuf_is_sane());
+    CHECK(!gnrc_pktbuf_is_empty());
+    CHECK(pkt->next == NULL);
+    CHECK(memcmp(pkt->data, _data + 40, 60) == 0);
+    gnrc_pktbuf_release(pkt);
+    return 1;
+}
+
+static int test_pktbuf_realloc_data__shrink_grow(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    pkt = gnrc_pktbuf_add(NULL, _data, 100, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt != NULL);
+    CHECK(gnrc_pktbuf_realloc_data(pkt, 20) == 0);
+    CHECK(pkt->size == 20);
+    CHECK(gnrc_pktbuf_realloc_data(pkt, 200) == 0);
+    CHECK(pkt->size == 200);
+    CHECK(memcmp(pkt->data, _data, 20) == 0);
+    CHECK(gnrc_pktbuf_realloc_data(pkt, 600) == 0);
+    CHECK(pkt->size == 600);
+    CHECK(memcmp(pkt->data, _data, 20) == 0);
+    CHECK(gnrc_pktbuf_realloc_data(pkt, _MAX_SIZE + 1) == ENOMEM);
+    CHECK(gnrc_pktbuf_realloc_data(pkt, 0) == 0);
+    CHECK(pkt->data == NULL);
+    CHECK(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    return 1;
+}
+
+static int test_pktbuf_realloc_data__shared(void)
+{
+    gnrc_pktsnip_t *pkt, *marked;
+
+    pkt = gnrc_pktbuf_add(NULL, _data, 100, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt != NULL);
+    marked = gnrc_pktbuf_mark(pkt, 40, GNRC_NETTYPE_TEST);
+    CHECK(marked != NULL);
+    /* growing the marked part must not overwrite the rest */
+    CHECK(gnrc_pktbuf_realloc_data(marked, 80) == 0);
+    memset(marked->data, 0xff, 80);
+    CHECK(memcmp(pkt->data, _data + 40, 60) == 0);
+    CHECK(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    return 1;
+}
+
+static int test_pktbuf_start_write__shared(void)
+{
+    gnrc_pktsnip_t *pkt, *clone;
+
+    pkt = gnrc_pktbuf_add(NULL, _data, 100, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt != NULL);
+    gnrc_pktbuf_hold(pkt, 1);
+    clone = gnrc_pktbuf_start_write(pkt);
+    CHECK(clone != NULL);
+    CHECK(clone != pkt);
+    CHECK(clone->data != pkt->data);
+    CHECK(pkt->users == 1);
+    CHECK(memcmp(clone->data, _data, 100) == 0);
+    gnrc_pktbuf_release(pkt);
+    gnrc_pktbuf_release(clone);
+    return 1;
+}
+
+static int test_pktbuf_get_iovec__success(void)
+{
+    gnrc_pktsnip_t *pkt, *head;
+    struct iovec *vec;
+    size_t len;
+
+    pkt = gnrc_pktbuf_add(NULL, _data, 100, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt != NULL);
+    pkt = gnrc_pktbuf_add(pkt, _data, 8, GNRC_NETTYPE_UNDEF);
+    CHECK(pkt != NULL);
+    head = gnrc_pktbuf_get_iovec(pkt, &len);
+    CHECK(head != NULL);
+    CHECK(len == 2);
+    vec = head->data;
+    CHECK(vec[0].iov_base == pkt->data);
+    CHECK(vec[0].iov_len == 8);
+    CHECK(vec[1].iov_base == pkt->next->data);
+    CHECK(vec[1].iov_len == 100);
+    gnrc_pktbuf_release(head);
+    return 1;
+}
+
+static void _bench_done(void *arg)
+{
+    *((volatile int *)arg) = 1;
+}
+
+static void _bench(const char *name, void (*op)(unsigned))
+{
+    volatile int done = 0;
+    unsigned long count = 0;
+    xtimer_t timer = { .callback = _bench_done, .arg = (void *)&done };
+
+    xtimer_set(&timer, BENCH_TIMEOUT_S * SEC_IN_USEC);
+    while (!done) {
+        op((unsigned)count++);
+    }
+    printf("%s: %lu ops/s\n", name, count / BENCH_TIMEOUT_S);
+}
+
+static void _bench_add_release(unsigned i)
+{
+    (void)i;
+    gnrc_pktbuf_release(gnrc_pktbuf_add(NULL, NULL, 64, GNRC_NETTYPE_UNDEF));
+}
+
+static void _bench_add_mark_release(unsigned i)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, 127, GNRC_NETTYPE_UNDEF);
+
+    (void)i;
+    /* strip link layer and IPv6 header like a receiving stack would */
+    gnrc_pktbuf_mark(pkt, 23, GNRC_NETTYPE_UNDEF);
+    gnrc_pktbuf_mark(pkt, 40, GNRC_NETTYPE_UNDEF);
+    gnrc_pktbuf_release(pkt);
+}
+
+static gnrc_pktsnip_t *_window[BENCH_WINDOW];
+
+static void _bench_interleaved(unsigned i)
+{
+    static const size_t sizes[] = { 16, 100, 600, 40, 8, 1280 };
+    unsigned slot = i % BENCH_WINDOW;
+
+    /* keep a window of packets with mixed sizes in flight to provoke
+     * fragmentation */
+    gnrc_pktbuf_release(_window[slot]);
+    _window[slot] = gnrc_pktbuf_add(NULL, NULL, sizes[i % 6], GNRC_NETTYPE_UNDEF);
+}
+
+int main(void)
+{
+    gnrc_pktbuf_init();
+
+    CALL(test_pktbuf_add__success());
+    CALL(test_pktbuf_add__too_large());
+    CALL(test_pktbuf_add__exhausted());
+    CALL(test_pktbuf_mark__success());
+    CALL(test_pktbuf_mark__release_order());
+    CALL(test_pktbuf_realloc_data__shrink_grow());
+    CALL(test_pktbuf_realloc_data__shared());
+    CALL(test_pktbuf_start_write__shared());
+    CALL(test_pktbuf_get_iovec__success());
+
+    puts("ALL TESTS SUCCESSFUL");
+
+    _bench("add/release", _bench_add_release);
+    _bench("add/mark/release", _bench_add_mark_release);
+    _bench("interleaved", _bench_interleaved);
+    for (unsigned i = 0; i < BENCH_WINDOW; i++) {
+        gnrc_pktbuf_release(_window[i]);
+    }
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("packet buffer not empty after benchmark");
+        puts("[FAILURE]");
+        return 1;
+    }
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    gnrc_pktbuf_stats();
+#endif
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2017 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+def testfunc(child):
+    child.expect_exact(u"Calling test_pktbuf_add__success()")
+    child.expect_exact(u"Calling test_pktbuf_add__too_large()")
+    child.expect_exact(u"Calling test_pktbuf_add__exhausted()")
+    child.expect_exact(u"Calling test_pktbuf_mark__success()")
+    child.expect_exact(u"Calling test_pktbuf_mark__release_order()")
+    child.expect_exact(u"Calling test_pktbuf_realloc_data__shrink_grow()")
+    child.expect_exact(u"Calling test_pktbuf_realloc_data__shared()")
+    child.expect_exact(u"Calling test_pktbuf_start_write__shared()")
+    child.expect_exact(u"Calling test_pktbuf_get_iovec__success()")
+    child.expect_exact(u"ALL TESTS SUCCESSFUL")
+    child.expect(u"add/release: \\d+ ops/s")
+    child.expect(u"add/mark/release: \\d+ ops/s")
+    child.expect(u"interleaved: \\d+ ops/s")
+    child.expect_exact(u"[SUCCESS]")
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc))
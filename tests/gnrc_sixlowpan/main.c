@@ -11,7 +11,8 @@
  * @{
  *
  * @file
- * @brief       Tests extension header handling of gnrc stack.
+ * @brief       Tests extension header handling of gnrc stack and the
+ *              fragmentation of outgoing 6LoWPAN datagrams.
  *
  * @author      Hauke Petersen <hauke.petersen@fu-berlin.de>
  * @author      Takuo Yonezawa <Yonezawa-T2@mail.dnp.co.jp>
@@ -19,11 +20,19 @@
  * @}
  */
 
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "shell.h"
 #include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
 #include "net/ipv6/addr.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
 #include "net/gnrc/ipv6/netif.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/pktbuf.h"
@@ -32,6 +41,232 @@
 #include "net/gnrc/netif.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pktdump.h"
+#include "net/gnrc/sixlowpan.h"
+#include "net/gnrc/sixlowpan/netif.h"
+
+#define MAX_FRAG_SIZE   (102U)      /**< IEEE 802.15.4 frame without MAC header */
+#define DATAGRAMS       (200U)
+#define DATAGRAM_SIZE   (1280U)
+#define BURST           (4U)
+#define CAPTURE_NUMOF   (32U)
+#define TIMEOUT         (100U * MS_IN_USEC)
+#define QUEUE_SIZE      (16U)
+#define MSG_TYPE_SENT   (0x4c50)    /**< last fragment of a datagram was sent */
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static char _burst_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _netif_queue[QUEUE_SIZE];
+static msg_t _main_queue[QUEUE_SIZE];
+static kernel_pid_t _main_pid, _netif_pid;
+static gnrc_netreg_entry_t _me;
+static gnrc_pktsnip_t *_captured[CAPTURE_NUMOF];
+static unsigned _captured_numof;
+static volatile bool _capture;
+static volatile uint32_t _frags;
+
+static const uint8_t _src_l2[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 };
+static const uint8_t _dst_l2[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 };
+
+/* turns a sent frame into a received one */
+static gnrc_pktsnip_t *_loop_back(gnrc_pktsnip_t *frame)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    size_t offset = 0;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, gnrc_pkt_len(frame->next),
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    for (gnrc_pktsnip_t *snip = frame->next; snip != NULL; snip = snip->next) {
+        memcpy((uint8_t *)pkt->data + offset, snip->data, snip->size);
+        offset += snip->size;
+    }
+    netif = gnrc_netif_hdr_build((uint8_t *)_src_l2, sizeof(_src_l2),
+                                 (uint8_t *)_dst_l2, sizeof(_dst_l2));
+    if (netif == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _netif_pid;
+    pkt->next = netif;
+
+    return pkt;
+}
+
+static bool _is_last(gnrc_pktsnip_t *frame)
+{
+    sixlowpan_frag_n_t *hdr = frame->next->data;
+    size_t len = gnrc_pkt_len(frame->next) - sizeof(sixlowpan_frag_n_t);
+
+    if (!sixlowpan_frag_is((sixlowpan_frag_t *)hdr)) {
+        return true;
+    }
+    if ((hdr->disp_size.u8[0] & SIXLOWPAN_FRAG_DISP_MASK) == SIXLOWPAN_FRAG_1_DISP) {
+        return false;
+    }
+    return ((hdr->offset * 8U) + len) >=
+           (byteorder_ntohs(hdr->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK);
+}
+
+/* stands in for the IEEE 802.15.4 interface */
+static void *_netif(void *arg)
+{
+    msg_t msg, sent = { .type = MSG_TYPE_SENT };
+
+    (void)arg;
+    msg_init_queue(_netif_queue, QUEUE_SIZE);
+    while (1) {
+        msg_receive(&msg);
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_SND) {
+            continue;
+        }
+        gnrc_pktsnip_t *frame = msg.content.ptr;
+
+        _frags++;
+        if (_capture && (_captured_numof < CAPTURE_NUMOF)) {
+            _captured[_captured_numof++] = _loop_back(frame);
+        }
+        if (_is_last(frame)) {
+            msg_try_send(&sent, _main_pid);
+        }
+        gnrc_pktbuf_release(frame);
+    }
+    return NULL;
+}
+
+static gnrc_pktsnip_t *_build(size_t size, uint8_t seq)
+{
+    gnrc_pktsnip_t *payload, *ipv6, *netif;
+    ipv6_hdr_t *hdr;
+    uint8_t *data;
+
+    payload = gnrc_pktbuf_add(NULL, NULL, size - sizeof(ipv6_hdr_t),
+                              GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return NULL;
+    }
+    data = payload->data;
+    for (unsigned i = 0; i < payload->size; i++) {
+        data[i] = (uint8_t)((i * 7) + seq);
+    }
+    ipv6 = gnrc_pktbuf_add(payload, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(payload);
+        return NULL;
+    }
+    hdr = ipv6->data;
+    memset(hdr, 0, sizeof(ipv6_hdr_t));
+    ipv6_hdr_set_version(hdr);
+    hdr->len = byteorder_htons(payload->size);
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = 64;
+    netif = gnrc_netif_hdr_build((uint8_t *)_src_l2, sizeof(_src_l2),
+                                 (uint8_t *)_dst_l2, sizeof(_dst_l2));
+    if (netif == NULL) {
+        gnrc_pktbuf_release(ipv6);
+        return NULL;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = _netif_pid;
+    netif->next = ipv6;
+
+    return netif;
+}
+
+static bool _send(size_t size, uint8_t seq)
+{
+    gnrc_pktsnip_t *pkt = _build(size, seq);
+
+    if (pkt == NULL) {
+        return false;
+    }
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    return true;
+}
+
+static bool _wait(uint16_t type, msg_t *msg)
+{
+    do {
+        if (xtimer_msg_receive_timeout(msg, TIMEOUT) < 0) {
+            return false;
+        }
+    } while (msg->type != type);
+    return true;
+}
+
+static bool _check(gnrc_pktsnip_t *pkt, size_t size, uint8_t seq)
+{
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    uint8_t *data;
+
+    if ((ipv6 == NULL) || (ipv6->size != size)) {
+        return false;
+    }
+    data = (uint8_t *)ipv6->data + sizeof(ipv6_hdr_t);
+    for (unsigned i = 0; i < (size - sizeof(ipv6_hdr_t)); i++) {
+        if (data[i] != (uint8_t)((i * 7) + seq)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* sends a datagram, feeds its fragments back and checks the reassembly */
+static bool _roundtrip(size_t size, uint8_t seq, bool shared)
+{
+    gnrc_pktsnip_t *pkt = _build(size, seq);
+    bool res;
+    msg_t msg;
+
+    if (pkt == NULL) {
+        return false;
+    }
+    if (shared) {
+        /* someone else still refers to the datagram, e.g. for retransmission */
+        gnrc_pktbuf_hold(pkt, 1);
+    }
+    _captured_numof = 0;
+    _capture = true;
+    if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                   GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+    }
+    res = _wait(MSG_TYPE_SENT, &msg);
+    _capture = false;
+    if (shared) {
+        res = res && (gnrc_pkt_len(pkt->next) == size);
+        gnrc_pktbuf_release(pkt);
+    }
+    for (unsigned i = 0; i < _captured_numof; i++) {
+        if ((_captured[i] == NULL) ||
+            !gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN,
+                                          GNRC_NETREG_DEMUX_CTX_ALL,
+                                          _captured[i])) {
+            gnrc_pktbuf_release(_captured[i]);
+        }
+    }
+    if (!res || !_wait(GNRC_NETAPI_MSG_TYPE_RCV, &msg)) {
+        return false;
+    }
+    res = _check(msg.content.ptr, size, seq);
+    gnrc_pktbuf_release(msg.content.ptr);
+
+    return res;
+}
+
+/* a thread of higher priority than 6LoWPAN's queues several datagrams */
+static void *_burst(void *arg)
+{
+    (void)arg;
+    for (unsigned i = 0; i < BURST; i++) {
+        _send(DATAGRAM_SIZE, i);
+    }
+    return NULL;
+}
 
 static void _init_interface(void)
 {
@@ -156,10 +391,79 @@ static void _send_packet(void)
     gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN, GNRC_NETREG_DEMUX_CTX_ALL, pkt2);
 }
 
+/* sends datagrams through 6LoWPAN to a stand-in interface, checks that their
+ * fragments reassemble and measures the fragmentation rate */
+static bool _test_frag(void)
+{
+    const size_t sizes[] = { 64, 200, 600, 1280 };
+    uint32_t start, frags;
+    unsigned sent;
+    msg_t msg;
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_PIPELINE
+    puts("6LoWPAN fragmentation test (pipeline: on)");
+#else
+    puts("6LoWPAN fragmentation test (pipeline: off)");
+#endif
+
+    _main_pid = sched_active_pid;
+    msg_init_queue(_main_queue, QUEUE_SIZE);
+    _netif_pid = thread_create(_netif_stack, sizeof(_netif_stack),
+                               GNRC_SIXLOWPAN_PRIO - 1, THREAD_CREATE_STACKTEST,
+                               _netif, NULL, "netif");
+    gnrc_sixlowpan_netif_add(_netif_pid, MAX_FRAG_SIZE);
+    gnrc_netreg_entry_init_pid(&_me, GNRC_NETREG_DEMUX_CTX_ALL, _main_pid);
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_me);
+
+    for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        bool ok = _roundtrip(sizes[i], i, (i & 1));
+
+        printf("reassembled %u bytes: %s\n", (unsigned)sizes[i],
+               ok ? "OK" : "FAILED");
+        if (!ok) {
+            return false;
+        }
+    }
+
+    frags = _frags;
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < DATAGRAMS; i++) {
+        if (!_send(DATAGRAM_SIZE, i) || !_wait(MSG_TYPE_SENT, &msg)) {
+            puts("datagram got lost");
+            return false;
+        }
+    }
+    start = xtimer_now_usec() - start;
+    frags = _frags - frags;
+    printf("serial: %u datagrams of %u bytes in %" PRIu32 " us, %" PRIu32
+           " fragments/s\n", DATAGRAMS, DATAGRAM_SIZE, start,
+           (uint32_t)(((uint64_t)frags * SEC_IN_USEC) / start));
+
+    thread_create(_burst_stack, sizeof(_burst_stack), GNRC_SIXLOWPAN_PRIO - 1,
+                  THREAD_CREATE_STACKTEST, _burst, NULL, "burst");
+    for (sent = 0; _wait(MSG_TYPE_SENT, &msg); sent++) {}
+    printf("burst: %u of %u datagrams sent\n", sent, BURST);
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_PIPELINE
+    if (sent != BURST) {
+        puts("queued datagrams were dropped");
+        return false;
+    }
+#endif
+    gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &_me);
+
+    return true;
+}
+
 int main(void)
 {
     puts("RIOT network stack example application");
 
+    /* runs before the packet dumps are registered for 6LoWPAN and IPv6 */
+    if (!_test_frag()) {
+        puts("[FAILURE]");
+        return 1;
+    }
     _init_interface();
     _send_packet();
 
@@ -14,6 +14,12 @@ sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
 import testrunner
 
 def testfunc(child):
+    # fragmentation
+    for size in (64, 200, 600, 1280):
+        child.expect_exact(u"reassembled {} bytes: OK".format(size))
+    child.expect(u"serial: \d+ datagrams of 1280 bytes in \d+ us, \d+ fragments/s")
+    child.expect(u"burst: \d+ of \d+ datagrams sent")
+
     # 1st 6LoWPAN fragment
     child.expect_exact("PKTDUMP: data received:")
     child.expect_exact("~~ SNIP  0 - size:  74 byte, type: NETTYPE_SIXLOWPAN (1)")
@@ -0,0 +1,341 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Checks the reassembly of incoming 6LoWPAN fragments
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "net/ieee802154.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#include "net/udp.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+
+#define DATAGRAM_SIZE   (192U)
+#define FRAG_SIZE       (64U)       /**< datagram bytes in each fragment */
+#define RECV_TIMEOUT    (100U * MS_IN_USEC)
+/* the reassembly buffer drops entries after 3 seconds without a fragment */
+#define REASSEMBLY_TIMEOUT    ((3U * SEC_IN_USEC) + (500U * MS_IN_USEC))
+#define QUEUE_SIZE      (8U)
+#define UDP_SRC_PORT    (0xf0b1)
+#define UDP_DST_PORT    (0xf0b2)
+#define UDP_CHECKSUM    (0xabcd)
+
+#define CALL(fn)            puts("Calling " # fn); \
+                            if (!fn) { \
+                                puts("[FAILURE]"); \
+                                return 1; \
+                            }
+
+static msg_t _main_queue[QUEUE_SIZE];
+
+static const uint8_t _src_l2[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 };
+static const uint8_t _other_src_l2[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x03 };
+static const uint8_t _dst_l2[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 };
+
+/* headers at the start of every datagram, as IPHC decompresses them */
+static struct {
+    ipv6_hdr_t ipv6;
+    udp_hdr_t udp;
+} _hdrs;
+
+static void _init_hdrs(void)
+{
+    ipv6_hdr_set_version(&_hdrs.ipv6);
+    _hdrs.ipv6.len = byteorder_htons(DATAGRAM_SIZE - sizeof(ipv6_hdr_t));
+    _hdrs.ipv6.nh = PROTNUM_UDP;
+    _hdrs.ipv6.hl = 64;
+    ipv6_addr_set_link_local_prefix(&_hdrs.ipv6.src);
+    ieee802154_get_iid((eui64_t *)&_hdrs.ipv6.src.u64[1], _src_l2,
+                       sizeof(_src_l2));
+    ipv6_addr_set_link_local_prefix(&_hdrs.ipv6.dst);
+    ieee802154_get_iid((eui64_t *)&_hdrs.ipv6.dst.u64[1], _dst_l2,
+                       sizeof(_dst_l2));
+    _hdrs.udp.src_port = byteorder_htons(UDP_SRC_PORT);
+    _hdrs.udp.dst_port = byteorder_htons(UDP_DST_PORT);
+    _hdrs.udp.length = _hdrs.ipv6.len;
+    _hdrs.udp.checksum = byteorder_htons(UDP_CHECKSUM);
+}
+
+static uint8_t _byte(uint8_t seq, unsigned pos)
+{
+    if (pos < sizeof(_hdrs)) {
+        return ((uint8_t *)&_hdrs)[pos];
+    }
+    return (uint8_t)((pos * 7) + seq);
+}
+
+/* hands a fragment over to 6LoWPAN as if it was received from src */
+static bool _dispatch(const uint8_t *src, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif;
+
+    netif = gnrc_netif_hdr_build((uint8_t *)src, sizeof(_src_l2),
+                                 (uint8_t *)_dst_l2, sizeof(_dst_l2));
+    if (netif == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = sched_active_pid;
+    pkt->next = netif;
+    if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN,
+                                      GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    return true;
+}
+
+/* hands a fragment of datagram seq over to 6LoWPAN as if it was received */
+static bool _recv_frag(const uint8_t *src, uint16_t tag, uint8_t seq,
+                       unsigned offset, unsigned len)
+{
+    size_t hdr_len = (offset == 0) ? (sizeof(sixlowpan_frag_t) + 1)
+                                   : sizeof(sixlowpan_frag_n_t);
+    gnrc_pktsnip_t *pkt;
+    sixlowpan_frag_n_t *hdr;
+    uint8_t *data;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, hdr_len + len, GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return false;
+    }
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(DATAGRAM_SIZE);
+    hdr->tag = byteorder_htons(tag);
+    if (offset == 0) {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+        /* the datagram is sent uncompressed */
+        ((uint8_t *)pkt->data)[sizeof(sixlowpan_frag_t)] = SIXLOWPAN_UNCOMP;
+    }
+    else {
+        hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
+        hdr->offset = offset / 8;
+    }
+    data = (uint8_t *)pkt->data + hdr_len;
+    for (unsigned i = 0; i < len; i++) {
+        data[i] = _byte(seq, offset + i);
+    }
+    return _dispatch(src, pkt);
+}
+
+/* hands the first fragment of datagram seq over to 6LoWPAN as if it was
+ * received, with the IPv6 header compressed by IPHC and, with nhc, the UDP
+ * header compressed by NHC */
+static bool _recv_first_iphc(uint16_t tag, uint8_t seq, bool nhc)
+{
+    uint8_t iphc[SIXLOWPAN_IPHC_HDR_LEN + 7];
+    size_t iphc_len = 0, hdrs_len = sizeof(ipv6_hdr_t);
+    gnrc_pktsnip_t *pkt;
+    sixlowpan_frag_t *hdr;
+    uint8_t *data;
+
+    /* traffic class and flow label elided, hop limit 64, both addresses
+     * derived from the link-layer addresses */
+    iphc[iphc_len++] = SIXLOWPAN_IPHC1_DISP | SIXLOWPAN_IPHC1_TF | 0x02;
+    iphc[iphc_len++] = SIXLOWPAN_IPHC2_SAM | SIXLOWPAN_IPHC2_DAM;
+    if (nhc) {
+        iphc[0] |= SIXLOWPAN_IPHC1_NH;
+        /* UDP with ports and checksum inline */
+        iphc[iphc_len++] = 0xf0;
+        memcpy(&iphc[iphc_len], &_hdrs.udp.src_port, 4);
+        iphc_len += 4;
+        memcpy(&iphc[iphc_len], &_hdrs.udp.checksum, 2);
+        iphc_len += 2;
+        hdrs_len += sizeof(udp_hdr_t);
+    }
+    else {
+        /* the UDP header follows uncompressed */
+        iphc[iphc_len++] = PROTNUM_UDP;
+    }
+
+    pkt = gnrc_pktbuf_add(NULL, NULL,
+                          sizeof(sixlowpan_frag_t) + iphc_len + FRAG_SIZE - hdrs_len,
+                          GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return false;
+    }
+    hdr = pkt->data;
+    hdr->disp_size = byteorder_htons(DATAGRAM_SIZE);
+    hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+    hdr->tag = byteorder_htons(tag);
+    data = (uint8_t *)(hdr + 1);
+    memcpy(data, iphc, iphc_len);
+    data += iphc_len;
+    for (unsigned i = hdrs_len; i < FRAG_SIZE; i++) {
+        *(data++) = _byte(seq, i);
+    }
+    return _dispatch(_src_l2, pkt);
+}
+
+static bool _recv(uint16_t tag, uint8_t seq, unsigned idx)
+{
+    return _recv_frag(_src_l2, tag, seq, idx * FRAG_SIZE, FRAG_SIZE);
+}
+
+/* checks that datagram seq was reassembled */
+static bool _expect(uint8_t seq)
+{
+    gnrc_pktsnip_t *ipv6;
+    bool res = true;
+    msg_t msg;
+
+    if ((xtimer_msg_receive_timeout(&msg, RECV_TIMEOUT) < 0) ||
+        (msg.type != GNRC_NETAPI_MSG_TYPE_RCV)) {
+        return false;
+    }
+    ipv6 = gnrc_pktsnip_search_type(msg.content.ptr, GNRC_NETTYPE_IPV6);
+    if ((ipv6 == NULL) || (ipv6->size != DATAGRAM_SIZE)) {
+        res = false;
+    }
+    for (unsigned i = 0; res && (i < DATAGRAM_SIZE); i++) {
+        res = (((uint8_t *)ipv6->data)[i] == _byte(seq, i));
+    }
+    gnrc_pktbuf_release(msg.content.ptr);
+    return res;
+}
+
+/* checks that no datagram was reassembled */
+static bool _expect_none(void)
+{
+    msg_t msg;
+
+    if (xtimer_msg_receive_timeout(&msg, RECV_TIMEOUT) < 0) {
+        return true;
+    }
+    if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+    return false;
+}
+
+static bool test_in_order(void)
+{
+    return _recv(1, 1, 0) && _recv(1, 1, 1) && _recv(1, 1, 2) &&
+           _expect(1) && _expect_none();
+}
+
+static bool test_out_of_order(void)
+{
+    return _recv(2, 2, 2) && _recv(2, 2, 0) && _recv(2, 2, 1) &&
+           _expect(2) && _expect_none();
+}
+
+static bool test_interleaved(void)
+{
+    /* both datagrams carry the same tag, but come from different sources */
+    return _recv(3, 3, 0) &&
+           _recv_frag(_other_src_l2, 3, 4, 2 * FRAG_SIZE, FRAG_SIZE) &&
+           _recv(3, 3, 1) &&
+           _recv_frag(_other_src_l2, 3, 4, 0, FRAG_SIZE) &&
+           _recv_frag(_other_src_l2, 3, 4, FRAG_SIZE, FRAG_SIZE) &&
+           _expect(4) &&
+           _recv(3, 3, 2) &&
+           _expect(3) && _expect_none();
+}
+
+static bool test_duplicate(void)
+{
+    /* a retransmitted fragment must not count twice */
+    return _recv(5, 5, 0) && _recv(5, 5, 1) && _recv(5, 5, 1) &&
+           _expect_none() &&
+           _recv(5, 5, 2) &&
+           _expect(5) && _expect_none();
+}
+
+static bool test_overlapping(void)
+{
+    /* the overlapping fragment discards the datagram and starts it anew */
+    return _recv(6, 6, 0) &&
+           _recv_frag(_src_l2, 6, 6, FRAG_SIZE / 2, FRAG_SIZE / 2) &&
+           _expect_none() &&
+           _recv_frag(_src_l2, 6, 6, 0, FRAG_SIZE / 2) &&
+           _recv(6, 6, 1) && _recv(6, 6, 2) &&
+           _expect(6) && _expect_none();
+}
+
+static bool test_iphc(void)
+{
+    return _recv_first_iphc(8, 8, false) && _recv(8, 8, 1) && _recv(8, 8, 2) &&
+           _expect(8) && _expect_none();
+}
+
+static bool test_iphc_nhc(void)
+{
+    /* the first fragment arrives out of order and twice, with the headers
+     * decompressed each time */
+    return _recv(9, 9, 2) && _recv_first_iphc(9, 9, true) &&
+           _recv_first_iphc(9, 9, true) && _expect_none() &&
+           _recv(9, 9, 1) &&
+           _expect(9) && _expect_none();
+}
+
+static bool test_timeout(void)
+{
+    if (!_recv(7, 7, 0) || !_recv(7, 7, 1)) {
+        return false;
+    }
+    xtimer_usleep(REASSEMBLY_TIMEOUT);
+    /* the first fragments timed out, so the last one starts a new datagram */
+    return _recv(7, 7, 2) &&
+           _expect_none() &&
+           _recv(7, 7, 0) && _recv(7, 7, 1) &&
+           _expect(7) && _expect_none();
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                        sched_active_pid);
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_CHAIN
+    puts("6LoWPAN reassembly test (chain: on)");
+#else
+    puts("6LoWPAN reassembly test (chain: off)");
+#endif
+
+    _init_hdrs();
+    msg_init_queue(_main_queue, QUEUE_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me);
+
+    CALL(test_in_order());
+    CALL(test_out_of_order());
+    CALL(test_interleaved());
+    CALL(test_duplicate());
+    CALL(test_overlapping());
+    CALL(test_iphc());
+    CALL(test_iphc_nhc());
+    CALL(test_timeout());
+
+    /* all datagrams are either delivered or dropped */
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("packet buffer not empty");
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2017 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+
+sys.path.append(os.path.join(os.environ['RIOTBASE'], 'dist/tools/testrunner'))
+import testrunner
+
+def testfunc(child):
+    child.expect_exact(u"Calling test_in_order()")
+    child.expect_exact(u"Calling test_out_of_order()")
+    child.expect_exact(u"Calling test_interleaved()")
+    child.expect_exact(u"Calling test_duplicate()")
+    child.expect_exact(u"Calling test_overlapping()")
+    child.expect_exact(u"Calling test_iphc()")
+    child.expect_exact(u"Calling test_iphc_nhc()")
+    child.expect_exact(u"Calling test_timeout()")
+    child.expect_exact(u"[SUCCESS]")
+
+if __name__ == "__main__":
+    sys.exit(testrunner.run(testfunc))
@@ -22,6 +22,10 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "net/gnrc/udp.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
 #include "net/sock/udp.h"
 #include "xtimer.h"
 
@@ -379,6 +383,67 @@ static void test_sock_udp_recv__non_blocking(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv__bad_csum(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t result;
+
+    assert(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    /* a corrupted packet is dropped before its size is checked */
+    assert(_inject_corrupted_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                                    _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                                    _TEST_NETIF));
+    assert(-ETIMEDOUT == sock_udp_recv(&_sock, _test_buffer, 2,
+                                       _TEST_TIMEOUT, NULL));
+    /* and does not hide the packet after it */
+    assert(_inject_corrupted_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                                    _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                                    _TEST_NETIF));
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFGH", sizeof("EFGH"),
+                          _TEST_NETIF));
+    assert(sizeof("EFGH") == sock_udp_recv(&_sock, _test_buffer,
+                                           sizeof(_test_buffer),
+                                           _TEST_TIMEOUT, &result));
+    assert(memcmp(_test_buffer, "EFGH", sizeof("EFGH")) == 0);
+    assert(AF_INET6 == result.family);
+    assert(memcmp(&result.addr, &src_addr, sizeof(result.addr)) == 0);
+    assert(_TEST_PORT_REMOTE == result.port);
+    assert(_TEST_NETIF == result.netif);
+    assert(_check_net());
+}
+
+static void test_sock_udp_recv__odd_len(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const char odd[] = "ABCDEF";    /* 7 bytes with the terminator */
+    static const char even[] = "ABCDEFG";  /* 8 bytes with the terminator */
+
+    assert(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    /* an odd payload length shifts the bytes summed behind it */
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, (void *)odd, sizeof(odd),
+                          _TEST_NETIF));
+    assert(sizeof(odd) == sock_udp_recv(&_sock, _test_buffer,
+                                        sizeof(_test_buffer),
+                                        _TEST_TIMEOUT, NULL));
+    assert(memcmp(_test_buffer, odd, sizeof(odd)) == 0);
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, (void *)even, sizeof(even),
+                          _TEST_NETIF));
+    assert(sizeof(even) == sock_udp_recv(&_sock, _test_buffer,
+                                         sizeof(_test_buffer),
+                                         _TEST_TIMEOUT, NULL));
+    assert(memcmp(_test_buffer, even, sizeof(even)) == 0);
+    assert(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -651,6 +716,51 @@ static void test_sock_udp_send__no_sock(void)
     assert(_check_net());
 }
 
+static void test_gnrc_udp__csum_presummed(void)
+{
+#ifdef MODULE_GNRC_UDP_CSUM_COPY
+    uint8_t payload_data[] = {
+        0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0, 0x0F,
+    };
+    gnrc_pktsnip_t pseudo_hdr, hdr, payload1, payload2;
+    ipv6_hdr_t pseudo_hdr_data;
+    udp_hdr_t hdr_data;
+    uint16_t expected;
+
+    memset(&pseudo_hdr, 0, sizeof(pseudo_hdr));
+    memset(&hdr, 0, sizeof(hdr));
+    memset(&payload1, 0, sizeof(payload1));
+    memset(&payload2, 0, sizeof(payload2));
+    memset(&hdr_data, 0, sizeof(hdr_data));
+    memset(&pseudo_hdr_data, 0, sizeof(pseudo_hdr_data));
+    pseudo_hdr_data.len = byteorder_htons(sizeof(hdr_data) + sizeof(payload_data));
+    pseudo_hdr_data.nh = PROTNUM_UDP;
+    pseudo_hdr.type = GNRC_NETTYPE_IPV6;
+    pseudo_hdr.data = &pseudo_hdr_data;
+    pseudo_hdr.size = sizeof(pseudo_hdr_data);
+    pseudo_hdr.next = &hdr;
+    hdr.type = GNRC_NETTYPE_UDP;
+    hdr.data = &hdr_data;
+    hdr.size = sizeof(hdr_data);
+    hdr.next = &payload1;
+    /* odd first slice, so the pre-summed second one starts at an odd offset */
+    payload1.data = payload_data;
+    payload1.size = 3;
+    payload1.next = &payload2;
+    payload2.data = &payload_data[3];
+    payload2.size = sizeof(payload_data) - 3;
+    assert(0 == gnrc_udp_calc_csum(&hdr, &pseudo_hdr));
+    expected = byteorder_ntohs(hdr_data.checksum);
+
+    hdr_data.checksum = byteorder_htons(0);
+    payload2.csum = inet_csum_slice(0, payload2.data, payload2.size, 0);
+    /* garble data, so only the pre-summed checksum can yield the result */
+    payload_data[5] ^= 0xFF;
+    assert(0 == gnrc_udp_calc_csum(&hdr, &pseudo_hdr));
+    assert(expected == byteorder_ntohs(hdr_data.checksum));
+#endif
+}
+
 int main(void)
 {
     _net_init();
@@ -680,6 +790,8 @@ int main(void)
     CALL(test_sock_udp_recv__unsocketed_with_remote());
     CALL(test_sock_udp_recv__with_timeout());
     CALL(test_sock_udp_recv__non_blocking());
+    CALL(test_sock_udp_recv__bad_csum());
+    CALL(test_sock_udp_recv__odd_len());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -697,6 +809,8 @@ int main(void)
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+    /* only tests anything with gnrc_udp_csum_copy */
+    CALL(test_gnrc_udp__csum_presummed());
 
     puts("ALL TESTS SUCCESSFUL");
 
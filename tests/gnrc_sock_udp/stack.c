@@ -13,6 +13,7 @@
  * @author  Martine Lenders <mlenders@inf.fu-berlin.de>
  */
 
+#include <assert.h>
 
 #include "msg.h"
 #include "net/gnrc/ipv6.h"
@@ -108,6 +109,23 @@ bool _inject_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
                                          GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
 }
 
+bool _inject_corrupted_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                              uint16_t src_port, uint16_t dst_port,
+                              void *data, size_t data_len, uint16_t netif)
+{
+    gnrc_pktsnip_t *pkt = _build_udp_packet(src, dst, src_port, dst_port,
+                                            data, data_len, netif);
+
+    assert(data_len > 0);
+    if (pkt == NULL) {
+        return false;
+    }
+    /* flip a bit of the payload after the checksum was calculated */
+    ((uint8_t *)pkt->data)[sizeof(udp_hdr_t)] ^= 0x01;
+    return (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP,
+                                         GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+}
+
 bool _check_net(void)
 {
     return (gnrc_pktbuf_is_sane() && gnrc_pktbuf_is_empty());
@@ -57,6 +57,25 @@ bool _inject_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
                     uint16_t src_port, uint16_t dst_port,
                     void *data, size_t data_len, uint16_t netif);
 
+/**
+ * @brief   Injects a received UDP packet with an invalid checksum into the
+ *          stack
+ *
+ * @param[in] src       The source address of the UDP packet
+ * @param[in] dst       The destination address of the UDP packet
+ * @param[in] src_port  The source port of the UDP packet
+ * @param[in] dst_port  The destination port of the UDP packet
+ * @param[in] data      The payload of the UDP packet, must not be empty
+ * @param[in] data_len  The payload length of the UDP packet
+ * @param[in] netif     The interface the packet came over
+ *
+ * @return  true, if packet was successfully injected
+ * @return  false, if an error occured during injection
+ */
+bool _inject_corrupted_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                              uint16_t src_port, uint16_t dst_port,
+                              void *data, size_t data_len, uint16_t netif);
+
 /**
  * @brief   Checks networking state (e.g. packet buffer state)
  *
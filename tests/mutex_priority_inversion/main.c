@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures the mutex wakeup latency of a high priority thread under
+ *          priority inversion
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define ROUNDS          (10U)
+#define CS_DURATION     (5000U)     /**< critical section of the low thread */
+#define HIGH_DELAY      (1000U)     /**< high thread blocks after this */
+#define MID_DELAY       (2000U)     /**< medium thread starts spinning after this */
+#define MID_DURATION    (20000U)    /**< busy time of the medium thread */
+
+#define PRIO_HIGH       (THREAD_PRIORITY_MAIN - 3)
+#define PRIO_MID        (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_LOW        (THREAD_PRIORITY_MAIN - 1)
+
+static char stack_high[THREAD_STACKSIZE_MAIN];
+static char stack_mid[THREAD_STACKSIZE_MAIN];
+static char stack_low[THREAD_STACKSIZE_MAIN];
+
+static kernel_pid_t pid_high, pid_mid, pid_low;
+static xtimer_t timer_high, timer_mid;
+static mutex_t mutex = MUTEX_INIT;
+static uint32_t latency;
+
+static void _spin(uint32_t duration)
+{
+    uint32_t start = xtimer_now_usec();
+
+    while ((xtimer_now_usec() - start) < duration) {}
+}
+
+static void _wakeup(void *arg)
+{
+    thread_wakeup((kernel_pid_t)(intptr_t)arg);
+}
+
+static void *_high(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_sleep();
+
+        uint32_t start = xtimer_now_usec();
+
+        mutex_lock(&mutex);
+        latency = xtimer_now_usec() - start;
+        mutex_unlock(&mutex);
+    }
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_sleep();
+        _spin(MID_DURATION);
+    }
+    return NULL;
+}
+
+static void *_low(void *arg)
+{
+    (void)arg;
+    while (1) {
+        thread_sleep();
+        mutex_lock(&mutex);
+        xtimer_set(&timer_high, HIGH_DELAY);
+        xtimer_set(&timer_mid, MID_DELAY);
+        _spin(CS_DURATION);
+        mutex_unlock(&mutex);
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    uint32_t worst = 0;
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    puts("Mutex priority inversion test (priority inheritance: on)");
+#else
+    puts("Mutex priority inversion test (priority inheritance: off)");
+#endif
+
+    pid_high = thread_create(stack_high, sizeof(stack_high), PRIO_HIGH, 0,
+                             _high, NULL, "high");
+    pid_mid = thread_create(stack_mid, sizeof(stack_mid), PRIO_MID, 0,
+                            _mid, NULL, "mid");
+    pid_low = thread_create(stack_low, sizeof(stack_low), PRIO_LOW, 0,
+                            _low, NULL, "low");
+
+    timer_high.callback = _wakeup;
+    timer_high.arg = (void *)(intptr_t)pid_high;
+    timer_mid.callback = _wakeup;
+    timer_mid.arg = (void *)(intptr_t)pid_mid;
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        /* main has the lowest priority, so it only continues once all other
+         * threads went back to sleep */
+        thread_wakeup(pid_low);
+        printf("round %u: latency %" PRIu32 " us\n", i, latency);
+        if (latency > worst) {
+            worst = latency;
+        }
+    }
+
+    printf("worst-case latency: %" PRIu32 " us\n", worst);
+    /* the high priority thread should never wait longer than the remainder
+     * of the low priority thread's critical section */
+    if (worst < CS_DURATION) {
+        puts("[SUCCESS]");
+    }
+    else {
+        puts("[FAILURE]");
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Sleeps for a simulated day, which native_virtual_time skips
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "thread.h"
+#include "xtimer.h"
+
+#define HOUR            (60LU * 60LU * SEC_IN_USEC)
+#define HOURS           (24U)
+#define TICK            (10U * SEC_IN_USEC)
+#define TICKS           ((HOURS * HOUR) / TICK)
+
+static char stack[THREAD_STACKSIZE_DEFAULT];
+static volatile unsigned ticks;
+
+static void *_ticker(void *arg)
+{
+    xtimer_ticks32_t last = xtimer_now();
+
+    (void)arg;
+    /* periodic activity as of a routing protocol */
+    while (ticks < TICKS) {
+        xtimer_periodic_wakeup(&last, TICK);
+        ticks++;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    uint64_t start = xtimer_now_usec64();
+
+    puts("Sleeping for a simulated day");
+
+    thread_create(stack, sizeof(stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _ticker, NULL, "ticker");
+
+    for (unsigned i = 1; i <= HOURS; i++) {
+        uint64_t before = xtimer_now_usec64();
+
+        xtimer_usleep64(HOUR);
+        if ((xtimer_now_usec64() - before) < HOUR) {
+            printf("hour %u: woke up early\n", i);
+            puts("[FAILURE]");
+            return 1;
+        }
+        printf("hour %u: %u ticks\n", i, ticks);
+    }
+
+    printf("slept %" PRIu32 " s\n",
+           (uint32_t)((xtimer_now_usec64() - start) / SEC_IN_USEC));
+    if (ticks != TICKS) {
+        printf("%u instead of %u ticks\n", ticks, (unsigned)TICKS);
+        puts("[FAILURE]");
+        return 1;
+    }
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measures the receive throughput of netdev2_tap
+ *
+ * Start one instance on each end of a tap pair, run `sink` on one and
+ * `flood` on the other. Build with `TAP_BATCH=0` to compare against the
+ * frame by frame receive path.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "shell.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define MAIN_QUEUE_SIZE     (32U)
+#define SINK_IDLE_TIMEOUT   (1U * SEC_IN_USEC)
+#define FLOOD_SIZE_DEFAULT  (64U)
+#define FLOOD_SIZE_MAX      (1500U)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static kernel_pid_t _iface(void)
+{
+    kernel_pid_t ifs[GNRC_NETIF_NUMOF];
+
+    if (gnrc_netif_get(ifs) == 0) {
+        return KERNEL_PID_UNDEF;
+    }
+    return ifs[0];
+}
+
+static int _sink(int argc, char **argv)
+{
+    gnrc_netreg_entry_t entry;
+    msg_t msg;
+    uint32_t first = 0, last = 0;
+    unsigned count = 0, frames;
+
+    if (argc < 2) {
+        printf("usage: %s <frames>\n", argv[0]);
+        return 1;
+    }
+    frames = (unsigned)atoi(argv[1]);
+
+    /* frames of unknown ethertype end up as GNRC_NETTYPE_UNDEF */
+    gnrc_netreg_entry_init_pid(&entry, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entry);
+    puts("sink: waiting for frames");
+
+    while (count < frames) {
+        /* only start the idle timeout with the first frame */
+        if (count == 0) {
+            msg_receive(&msg);
+        }
+        else if (xtimer_msg_receive_timeout(&msg, SINK_IDLE_TIMEOUT) < 0) {
+            break;
+        }
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_RCV) {
+            continue;
+        }
+        last = xtimer_now_usec();
+        if (count++ == 0) {
+            first = last;
+        }
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_UNDEF, &entry);
+
+    uint32_t duration = last - first;
+
+    printf("sink: received %u frames in %" PRIu32 " us", count, duration);
+    if ((count > 1) && (duration > 0)) {
+        printf(": %" PRIu32 " frames/s",
+               (uint32_t)(((uint64_t)(count - 1) * SEC_IN_USEC) / duration));
+    }
+    puts("");
+    return 0;
+}
+
+static int _flood(int argc, char **argv)
+{
+    kernel_pid_t iface = _iface();
+    unsigned frames, size = FLOOD_SIZE_DEFAULT;
+
+    if (argc < 2) {
+        printf("usage: %s <frames> [<size>]\n", argv[0]);
+        return 1;
+    }
+    frames = (unsigned)atoi(argv[1]);
+    if (argc > 2) {
+        size = (unsigned)atoi(argv[2]);
+    }
+    if ((size == 0) || (size > FLOOD_SIZE_MAX)) {
+        printf("flood: size must be between 1 and %u\n", FLOOD_SIZE_MAX);
+        return 1;
+    }
+    if (iface == KERNEL_PID_UNDEF) {
+        puts("flood: no interface");
+        return 1;
+    }
+
+    uint32_t start = xtimer_now_usec();
+    unsigned sent = 0;
+
+    for (unsigned i = 0; i < frames; i++) {
+        gnrc_pktsnip_t *payload, *netif;
+
+        payload = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+        if (payload == NULL) {
+            continue;
+        }
+        memset(payload->data, (uint8_t)i, size);
+        netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+        if (netif == NULL) {
+            gnrc_pktbuf_release(payload);
+            continue;
+        }
+        ((gnrc_netif_hdr_t *)netif->data)->flags |= GNRC_NETIF_HDR_FLAGS_BROADCAST;
+        LL_PREPEND(payload, netif);
+        /* blocks while the interface's message queue is full */
+        if (gnrc_netapi_send(iface, netif) < 1) {
+            gnrc_pktbuf_release(netif);
+            continue;
+        }
+        sent++;
+    }
+
+    printf("flood: sent %u frames of %u byte in %" PRIu32 " us\n", sent, size,
+           xtimer_now_usec() - start);
+    return 0;
+}
+
+static const shell_command_t shell_commands[] = {
+    { "sink", "count broadcast frames of unknown ethertype", _sink },
+    { "flood", "send broadcast frames of unknown ethertype", _flood },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+#ifdef MODULE_NETDEV2_TAP_BATCH
+    puts("netdev2_tap throughput test (batched receive)");
+#else
+    puts("netdev2_tap throughput test");
+#endif
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(shell_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
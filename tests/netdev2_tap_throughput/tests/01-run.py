@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2017 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+import pexpect
+
+FRAMES = 10000
+TIMEOUT = 30
+
+
+def spawn(app_dir, port):
+    env = os.environ.copy()
+    env['BOARD'] = 'native'
+    env['PORT'] = port
+    return pexpect.spawnu("make", ["-C", app_dir, "term"], env=env,
+                          timeout=TIMEOUT, logfile=sys.stdout)
+
+
+def testfunc(app_dir):
+    sink = spawn(app_dir, "tap0")
+    flood = spawn(app_dir, "tap1")
+    try:
+        sink.expect(u"netdev2_tap throughput test")
+        flood.expect(u"netdev2_tap throughput test")
+        sink.sendline(u"sink %d" % FRAMES)
+        sink.expect_exact(u"sink: waiting for frames")
+        flood.sendline(u"flood %d" % FRAMES)
+        flood.expect(u"flood: sent %d frames of \\d+ byte in \\d+ us" % FRAMES)
+        sink.expect(u"sink: received \\d+ frames in \\d+ us: \\d+ frames/s")
+    finally:
+        sink.terminate(force=True)
+        flood.terminate(force=True)
+
+
+if __name__ == "__main__":
+    testfunc(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    print("[SUCCESS]")
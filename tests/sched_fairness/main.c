@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Measures how fair busy threads of equal priority share the CPU
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "sched.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define WORKERS         (4U)
+#define DURATION        (2U * SEC_IN_USEC)
+/** minimal share of the slowest worker relative to the fastest in percent */
+#define MIN_SHARE       (50U)
+
+#define PRIO_WORKER     (THREAD_PRIORITY_MAIN + 1)
+
+static char stacks[WORKERS][THREAD_STACKSIZE_DEFAULT];
+
+static volatile uint32_t counts[WORKERS];
+static volatile uint32_t slices[WORKERS];
+static volatile unsigned last = WORKERS;
+
+static void *_worker(void *arg)
+{
+    unsigned me = (unsigned)(uintptr_t)arg;
+
+    /* never yields nor blocks, other workers only get to run if the
+     * scheduler preempts this one */
+    while (1) {
+        if (last != me) {
+            last = me;
+            slices[me]++;
+        }
+        counts[me]++;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    uint32_t min = UINT32_MAX, max = 0, total = 0;
+
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    printf("Scheduler fairness test (round robin: %u us slices)\n",
+           (unsigned)SCHED_RR_SLICE);
+#else
+    puts("Scheduler fairness test (round robin: off)");
+#endif
+
+    for (unsigned i = 0; i < WORKERS; i++) {
+        thread_create(stacks[i], sizeof(stacks[i]), PRIO_WORKER,
+                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                      _worker, (void *)(uintptr_t)i, "worker");
+    }
+
+    /* the workers only run while main sleeps */
+    xtimer_usleep(DURATION);
+
+    for (unsigned i = 0; i < WORKERS; i++) {
+        uint32_t count = counts[i];
+
+        printf("worker %u: %" PRIu32 " iterations in %" PRIu32 " slices\n",
+               i, count, slices[i]);
+        total += count;
+        if (count < min) {
+            min = count;
+        }
+        if (count > max) {
+            max = count;
+        }
+    }
+
+    printf("total: %" PRIu32 " iterations/s\n",
+           (uint32_t)(((uint64_t)total * SEC_IN_USEC) / DURATION));
+    printf("share of the slowest worker: %" PRIu32 " %%\n",
+           (max > 0) ? (uint32_t)(((uint64_t)min * 100) / max) : 0);
+
+    if ((max > 0) && (((uint64_t)min * 100) >= ((uint64_t)max * MIN_SHARE))) {
+        puts("[SUCCESS]");
+    }
+    else {
+        puts("[FAILURE]");
+    }
+
+    return 0;
+}
@@ -41,6 +41,7 @@ int main(void)
     P(flags);
 #endif
     P(rq_entry);
+    P(rq_prev);
 #ifdef MODULE_CORE_MSG
     P(wait_data);
     P(msg_waiters);
@@ -0,0 +1,100 @@
+/* DO NOT edit this file, your changes will be overwritten and won't take any effect! */
+/* Generated from CFLAGS: -DCRYPTO_THREEDES -DFIB_DEVEL_HELPER -DUNIVERSAL_ADDRESS_SIZE=16 -DUNIVERSAL_ADDRESS_MAX_ENTRIES=40 -DFIB_DEVEL_HELPER -DUNIVERSAL_ADDRESS_SIZE=16 -DUNIVERSAL_ADDRESS_MAX_ENTRIES=40 -DGNRC_NETIF_NUMOF=3 -DGNRC_NETIF_NUMOF=3 -DUNIVERSAL_ADDRESS_SIZE=16 -DUNIVERSAL_ADDRESS_MAX_ENTRIES=40 -Werror -Wall -Wextra -pedantic -std=gnu99 -ffunction-sections -fdata-sections -DDEBUG_ASSERT_VERBOSE -DBOARD_NATIVE="native" -DRIOT_BOARD=BOARD_NATIVE -DCPU_NATIVE="native" -DRIOT_CPU=CPU_NATIVE -DMCU_NATIVE="native" -DRIOT_MCU=MCU_NATIVE -fno-delete-null-pointer-checks -Wstrict-prototypes -Werror=strict-prototypes -Wold-style-definition -Werror=old-style-definition -fno-common -Wall -DNDEBUG -DSOCK_HAS_IPV6 -DFEATURE_PERIPH_TIMER -DMODULE_BASE64 -DMODULE_BITFIELD -DMODULE_BLOOM -DMODULE_BOARD -DMODULE_CBOR -DMODULE_CHECKSUM -DMODULE_CIPHER_MODES -DMODULE_COLOR -DMODULE_CORE -DMODULE_CORE_MBOX -DMODULE_CORE_MSG -DMODULE_CPU -DMODULE_CRYPTO -DMODULE_DIV -DMODULE_EMBUNIT -DMODULE_FIB -DMODULE_FMT -DMODULE_GCOAP -DMODULE_GNRC -DMODULE_GNRC_ICMPV6 -DMODULE_GNRC_IPV6 -DMODULE_GNRC_IPV6_HDR -DMODULE_GNRC_IPV6_NC -DMODULE_GNRC_IPV6_NETIF -DMODULE_GNRC_NDP -DMODULE_GNRC_NDP_INTERNAL -DMODULE_GNRC_NDP_NODE -DMODULE_GNRC_NETAPI -DMODULE_GNRC_NETAPI_MBOX -DMODULE_GNRC_NETIF -DMODULE_GNRC_NETIF_HDR -DMODULE_GNRC_NETREG -DMODULE_GNRC_PKT -DMODULE_GNRC_PKTBUF -DMODULE_GNRC_PKTBUF_STATIC -DMODULE_GNRC_PRIORITY_PKTQUEUE -DMODULE_GNRC_RPL_SRH -DMODULE_GNRC_SIXLOWPAN -DMODULE_GNRC_SIXLOWPAN_CTX -DMODULE_GNRC_SIXLOWPAN_ND -DMODULE_GNRC_SIXLOWPAN_NETIF -DMODULE_GNRC_SOCK -DMODULE_GNRC_SOCK_UDP -DMODULE_GNRC_UDP -DMODULE_HAMMING256 -DMODULE_HASHES -DMODULE_IEEE802154 -DMODULE_INET_CSUM -DMODULE_IPV4_ADDR -DMODULE_IPV6_ADDR -DMODULE_IPV6_EXT -DMODULE_IPV6_EXT_RH -DMODULE_IPV6_HDR -DMODULE_NANOCOAP -DMODULE_NATIVE_DRIVERS -DMODULE_NETOPT -DMODULE_OD -DMODULE_PERIPH -DMODULE_PHYDAT -DMODULE_PIPE -DMODULE_PKTQUEUE -DMODULE_PRINTF_FLOAT -DMODULE_PRNG_TINYMT32 -DMODULE_RANDOM -DMODULE_RELIC -DMODULE_SAUL -DMODULE_SAUL_REG -DMODULE_SEQ -DMODULE_SIXLOWPAN -DMODULE_SYS -DMODULE_TIMEX -DMODULE_TINYMT32 -DMODULE_UBJSON -DMODULE_UDP -DMODULE_UNIVERSAL_ADDRESS -DMODULE_XTIMER -DRIOT_VERSION="1d3a-vm" */
+#define CRYPTO_THREEDES 1
+#define FIB_DEVEL_HELPER 1
+#define UNIVERSAL_ADDRESS_SIZE 16
+#define UNIVERSAL_ADDRESS_MAX_ENTRIES 40
+#define FIB_DEVEL_HELPER 1
+#define UNIVERSAL_ADDRESS_SIZE 16
+#define UNIVERSAL_ADDRESS_MAX_ENTRIES 40
+#define GNRC_NETIF_NUMOF 3
+#define GNRC_NETIF_NUMOF 3
+#define UNIVERSAL_ADDRESS_SIZE 16
+#define UNIVERSAL_ADDRESS_MAX_ENTRIES 40
+#define DEBUG_ASSERT_VERBOSE 1
+#define BOARD_NATIVE "native"
+#define RIOT_BOARD BOARD_NATIVE
+#define CPU_NATIVE "native"
+#define RIOT_CPU CPU_NATIVE
+#define MCU_NATIVE "native"
+#define RIOT_MCU MCU_NATIVE
+#define NDEBUG 1
+#define SOCK_HAS_IPV6 1
+#define FEATURE_PERIPH_TIMER 1
+#define MODULE_BASE64 1
+#define MODULE_BITFIELD 1
+#define MODULE_BLOOM 1
+#define MODULE_BOARD 1
+#define MODULE_CBOR 1
+#define MODULE_CHECKSUM 1
+#define MODULE_CIPHER_MODES 1
+#define MODULE_COLOR 1
+#define MODULE_CORE 1
+#define MODULE_CORE_MBOX 1
+#define MODULE_CORE_MSG 1
+#define MODULE_CPU 1
+#define MODULE_CRYPTO 1
+#define MODULE_DIV 1
+#define MODULE_EMBUNIT 1
+#define MODULE_FIB 1
+#define MODULE_FMT 1
+#define MODULE_GCOAP 1
+#define MODULE_GNRC 1
+#define MODULE_GNRC_ICMPV6 1
+#define MODULE_GNRC_IPV6 1
+#define MODULE_GNRC_IPV6_HDR 1
+#define MODULE_GNRC_IPV6_NC 1
+#define MODULE_GNRC_IPV6_NETIF 1
+#define MODULE_GNRC_NDP 1
+#define MODULE_GNRC_NDP_INTERNAL 1
+#define MODULE_GNRC_NDP_NODE 1
+#define MODULE_GNRC_NETAPI 1
+#define MODULE_GNRC_NETAPI_MBOX 1
+#define MODULE_GNRC_NETIF 1
+#define MODULE_GNRC_NETIF_HDR 1
+#define MODULE_GNRC_NETREG 1
+#define MODULE_GNRC_PKT 1
+#define MODULE_GNRC_PKTBUF 1
+#define MODULE_GNRC_PKTBUF_STATIC 1
+#define MODULE_GNRC_PRIORITY_PKTQUEUE 1
+#define MODULE_GNRC_RPL_SRH 1
+#define MODULE_GNRC_SIXLOWPAN 1
+#define MODULE_GNRC_SIXLOWPAN_CTX 1
+#define MODULE_GNRC_SIXLOWPAN_ND 1
+#define MODULE_GNRC_SIXLOWPAN_NETIF 1
+#define MODULE_GNRC_SOCK 1
+#define MODULE_GNRC_SOCK_UDP 1
+#define MODULE_GNRC_UDP 1
+#define MODULE_HAMMING256 1
+#define MODULE_HASHES 1
+#define MODULE_IEEE802154 1
+#define MODULE_INET_CSUM 1
+#define MODULE_IPV4_ADDR 1
+#define MODULE_IPV6_ADDR 1
+#define MODULE_IPV6_EXT 1
+#define MODULE_IPV6_EXT_RH 1
+#define MODULE_IPV6_HDR 1
+#define MODULE_NANOCOAP 1
+#define MODULE_NATIVE_DRIVERS 1
+#define MODULE_NETOPT 1
+#define MODULE_OD 1
+#define MODULE_PERIPH 1
+#define MODULE_PHYDAT 1
+#define MODULE_PIPE 1
+#define MODULE_PKTQUEUE 1
+#define MODULE_PRINTF_FLOAT 1
+#define MODULE_PRNG_TINYMT32 1
+#define MODULE_RANDOM 1
+#define MODULE_RELIC 1
+#define MODULE_SAUL 1
+#define MODULE_SAUL_REG 1
+#define MODULE_SEQ 1
+#define MODULE_SIXLOWPAN 1
+#define MODULE_SYS 1
+#define MODULE_TIMEX 1
+#define MODULE_TINYMT32 1
+#define MODULE_UBJSON 1
+#define MODULE_UDP 1
+#define MODULE_UNIVERSAL_ADDRESS 1
+#define MODULE_XTIMER 1
+#define RIOT_VERSION "1d3a-vm"
@@ -16,6 +16,8 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <string.h>
+
 #include "thread.h"
 #include "ringbuffer.h"
 #include "mutex.h"
@@ -114,10 +116,62 @@ static void tests_core_ringbuffer(void)
     run_add();
 }
 
+static void tests_core_ringbuffer_bulk(void)
+{
+    char buf[BUF_SIZE], data[BUF_SIZE + 1], out[BUF_SIZE + 1];
+    ringbuffer_t bulk_rb = RINGBUFFER_INIT(buf);
+    char *region;
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = (char)('a' + i);
+    }
+
+    /* only as much as fits is added */
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE, ringbuffer_add(&bulk_rb, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, ringbuffer_add(&bulk_rb, data, 1));
+    TEST_ASSERT_EQUAL_INT(5, ringbuffer_get(&bulk_rb, out, 5));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, out, 5));
+
+    /* wrap around the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(4, ringbuffer_add(&bulk_rb, data, 4));
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE - 1, bulk_rb.avail);
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE - 1, ringbuffer_get(&bulk_rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 5, out, 2));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, out + 2, 4));
+
+    /* regions: an empty buffer is contiguous as a whole */
+    TEST_ASSERT_EQUAL_INT(0, ringbuffer_get_region(&bulk_rb, &region));
+    TEST_ASSERT_EQUAL_INT(BUF_SIZE, ringbuffer_add_region(&bulk_rb, &region));
+    memcpy(region, data, 6);
+    ringbuffer_add_commit(&bulk_rb, 6);
+    TEST_ASSERT_EQUAL_INT(6, ringbuffer_get_region(&bulk_rb, &region));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, region, 4));
+    ringbuffer_get_commit(&bulk_rb, 4);
+
+    /* free space wraps around: only the part up to the end is returned */
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_add_region(&bulk_rb, &region));
+    *region = data[6];
+    ringbuffer_add_commit(&bulk_rb, 1);
+    TEST_ASSERT_EQUAL_INT(4, ringbuffer_add_region(&bulk_rb, &region));
+    TEST_ASSERT(region == buf);
+    memcpy(region, data + 7, 1);
+    ringbuffer_add_commit(&bulk_rb, 1);
+
+    /* data wraps around: only the part up to the end is returned */
+    TEST_ASSERT_EQUAL_INT(3, ringbuffer_get_region(&bulk_rb, &region));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 4, region, 3));
+    ringbuffer_get_commit(&bulk_rb, 3);
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_get_region(&bulk_rb, &region));
+    TEST_ASSERT_EQUAL_INT(data[7], *region);
+    ringbuffer_get_commit(&bulk_rb, 1);
+    TEST_ASSERT(ringbuffer_empty(&bulk_rb));
+}
+
 Test *tests_core_ringbuffer_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(tests_core_ringbuffer),
+        new_TestFixture(tests_core_ringbuffer_bulk),
     };
 
     EMB_UNIT_TESTCALLER(ringbuffer_tests, NULL, NULL, fixtures);
@@ -20,6 +20,7 @@
 #include "universal_address.h"
 
 #define TEST_FIB_TABLE_SIZE (20)
+
 static fib_entry_t _entries[TEST_FIB_TABLE_SIZE];
 static fib_table_t test_fib_table = { .data.entries = _entries,
                                       .table_type = FIB_TABLE_TYPE_SH,
@@ -977,6 +978,178 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief testing the longest prefix match on nested prefixes
+* It is expected to receive the next hop of the longest matching prefix and
+* the exact match over any prefix
+*/
+static void test_fib_21_longest_prefix_match(void)
+{
+    size_t add_buf_size = 16;
+    uint8_t addr_dst[add_buf_size];
+    uint8_t addr_nxt[add_buf_size];
+    uint8_t addr_lookup[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+    uint64_t lifetime;
+    /* prefix lengths to add, the next hop is marked with the index */
+    static const uint8_t prefix_lens[] = { 0, 16, 64, 120, 48, 72 };
+
+    memset(addr_nxt, 0, add_buf_size);
+    for (size_t i = 0; i < sizeof(prefix_lens); ++i) {
+        memset(addr_dst, 0, add_buf_size);
+        if (prefix_lens[i] != 0) {
+            /* the 72 bit prefix is a sibling of the 120 bit one */
+            memset(addr_dst, 0xaa, prefix_lens[i] >> 3);
+            addr_dst[8] = (prefix_lens[i] == 72) ? 0xbb : addr_dst[8];
+        }
+        addr_nxt[0] = i;
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                              add_buf_size,
+                              ((uint32_t)prefix_lens[i] << FIB_FLAG_NET_PREFIX_SHIFT),
+                              addr_nxt, add_buf_size, 0x23, 100000));
+    }
+
+    /* matches up to the 120 bit prefix */
+    memset(addr_lookup, 0xaa, add_buf_size);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x23));
+    TEST_ASSERT_EQUAL_INT(3, addr_nxt[0]);
+
+    /* diverges within the 120 bit prefix */
+    addr_lookup[12] = 0x00;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x23));
+    TEST_ASSERT_EQUAL_INT(2, addr_nxt[0]);
+
+    /* falls into the 72 bit sibling */
+    addr_lookup[8] = 0xbb;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x23));
+    TEST_ASSERT_EQUAL_INT(5, addr_nxt[0]);
+
+    /* diverges within the 64 bit prefix */
+    addr_lookup[7] = 0x00;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x23));
+    TEST_ASSERT_EQUAL_INT(4, addr_nxt[0]);
+
+    /* only the default route is left */
+    addr_lookup[0] = 0x00;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x23));
+    TEST_ASSERT_EQUAL_INT(0, addr_nxt[0]);
+
+    /* the exact address of a prefix entry is an exact match */
+    memset(addr_lookup, 0, add_buf_size);
+    memset(addr_lookup, 0xaa, 2);
+    TEST_ASSERT_EQUAL_INT(0, fib_devel_get_lifetime(&test_fib_table,
+                          &lifetime, addr_lookup, add_buf_size));
+
+    /* removing the 64 bit prefix must keep the nested ones reachable */
+    memset(addr_dst, 0, add_buf_size);
+    memset(addr_dst, 0xaa, 8);
+    fib_remove_entry(&test_fib_table, addr_dst, add_buf_size);
+    TEST_ASSERT_EQUAL_INT(5, fib_get_num_used_entries(&test_fib_table));
+    memset(addr_lookup, 0xaa, add_buf_size);
+    addr_lookup[12] = 0x00;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x23));
+    TEST_ASSERT_EQUAL_INT(4, addr_nxt[0]);
+    memset(addr_lookup, 0xaa, add_buf_size);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x23));
+    TEST_ASSERT_EQUAL_INT(3, addr_nxt[0]);
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_routes(&test_fib_table);
+    puts("");
+#endif
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief testing the removal of expired entries
+* It is expected to have the expired entry and its universal addresses removed
+* without looking it up
+*/
+static void test_fib_22_lifetime_expired(void)
+{
+    size_t add_buf_size = 16;
+    char addr_dst[] = "Test address221";
+    char addr_nxt[] = "Test address222";
+
+    _fill_FIB_unique(2);
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                          (uint8_t *)addr_dst, add_buf_size - 1, 0x22,
+                          (uint8_t *)addr_nxt, add_buf_size - 1, 0x22, 1));
+    TEST_ASSERT_EQUAL_INT(3, fib_get_num_used_entries(&test_fib_table));
+    TEST_ASSERT_EQUAL_INT(6, universal_address_get_num_used_entries());
+
+    xtimer_usleep(10 * MS_IN_USEC);
+
+    TEST_ASSERT_EQUAL_INT(2, fib_get_num_used_entries(&test_fib_table));
+    TEST_ASSERT_EQUAL_INT(4, universal_address_get_num_used_entries());
+
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief testing the generation of the table
+* It is expected to change on adding, updating, removing and expiring entries
+* and to stay the same on lookups
+*/
+static void test_fib_23_generation(void)
+{
+    size_t add_buf_size = 16;
+    char addr_dst[] = "Test address231";
+    char addr_nxt[] = "Test address232";
+    char addr_lookup[add_buf_size];
+    size_t lookup_size = add_buf_size;
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+    unsigned gen = fib_get_generation(&test_fib_table);
+
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                          (uint8_t *)addr_dst, add_buf_size - 1, 0x23,
+                          (uint8_t *)addr_nxt, add_buf_size - 1, 0x23, 10000));
+    TEST_ASSERT(gen != fib_get_generation(&test_fib_table));
+
+    gen = fib_get_generation(&test_fib_table);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          (uint8_t *)addr_lookup, &lookup_size, &next_hop_flags,
+                          (uint8_t *)addr_dst, add_buf_size - 1, 0x23));
+    TEST_ASSERT_EQUAL_INT(gen, fib_get_generation(&test_fib_table));
+
+    TEST_ASSERT_EQUAL_INT(0, fib_update_entry(&test_fib_table,
+                          (uint8_t *)addr_dst, add_buf_size - 1,
+                          (uint8_t *)addr_nxt, add_buf_size - 1, 0x23, 1));
+    TEST_ASSERT(gen != fib_get_generation(&test_fib_table));
+
+    /* expiring changes the generation before the entry is removed */
+    gen = fib_get_generation(&test_fib_table);
+    xtimer_usleep(10 * MS_IN_USEC);
+    TEST_ASSERT(gen != fib_get_generation(&test_fib_table));
+    TEST_ASSERT_EQUAL_INT(0, fib_get_num_used_entries(&test_fib_table));
+
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                          (uint8_t *)addr_dst, add_buf_size - 1, 0x23,
+                          (uint8_t *)addr_nxt, add_buf_size - 1, 0x23,
+                          10000));
+    gen = fib_get_generation(&test_fib_table);
+    fib_remove_entry(&test_fib_table, (uint8_t *)addr_dst, add_buf_size - 1);
+    TEST_ASSERT(gen != fib_get_generation(&test_fib_table));
+
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1001,6 +1174,9 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_longest_prefix_match),
+                        new_TestFixture(test_fib_22_lifetime_expired),
+                        new_TestFixture(test_fib_23_generation),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
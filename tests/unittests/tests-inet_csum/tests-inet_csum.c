@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -21,6 +22,59 @@
 #include "unittests-constants.h"
 #include "tests-inet_csum.h"
 
+#define TEST_BUF_SIZE           (1280U)
+
+static uint8_t _buf[TEST_BUF_SIZE + sizeof(uint32_t)];
+static uint32_t _state;
+
+static uint32_t _rand(void)
+{
+    /* xorshift32, so the sequence is the same on every platform */
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+static void _fill(uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = _rand();
+    }
+}
+
+/* one 16-bit word per iteration, as inet_csum_slice() did originally */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (int i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void set_up(void)
+{
+    _state = 0x1badcafe;
+}
+
 static void test_inet_csum__rfc_example(void)
 {
     /* source: https://tools.ietf.org/html/rfc1071#section-3 */
@@ -165,6 +219,93 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__equivalence(void)
+{
+    const uint16_t sums[] = { 0x0000, 0xffff, 0x1785 };
+
+    _fill(_buf, sizeof(_buf));
+    /* all alignments, lengths around the unrolled loop and both parities */
+    for (unsigned offset = 0; offset < sizeof(uint32_t); offset++) {
+        for (uint16_t len = 0; len <= 80; len++) {
+            for (size_t accum_len = 0; accum_len < 2; accum_len++) {
+                for (unsigned i = 0; i < sizeof(sums) / sizeof(sums[0]); i++) {
+                    TEST_ASSERT_EQUAL_INT(
+                        _ref_csum_slice(sums[i], _buf + offset, len, accum_len),
+                        inet_csum_slice(sums[i], _buf + offset, len, accum_len));
+                }
+            }
+        }
+    }
+}
+
+static void test_inet_csum__equivalence_random(void)
+{
+    for (unsigned i = 0; i < 1000; i++) {
+        unsigned offset = _rand() % sizeof(uint32_t);
+        uint16_t len = _rand() % (TEST_BUF_SIZE + 1);
+        uint16_t sum = _rand();
+        size_t accum_len = _rand();
+
+        _fill(_buf + offset, len);
+        TEST_ASSERT_EQUAL_INT(_ref_csum_slice(sum, _buf + offset, len, accum_len),
+                              inet_csum_slice(sum, _buf + offset, len, accum_len));
+    }
+}
+
+static void test_inet_csum__all_ones(void)
+{
+    /* a sum of only 0xffff words must stay 0xffff, not wrap to 0 */
+    memset(_buf, 0xff, sizeof(_buf));
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(0, _buf, TEST_BUF_SIZE));
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(0xffff, _buf + 1, TEST_BUF_SIZE));
+    memset(_buf, 0, sizeof(_buf));
+    TEST_ASSERT_EQUAL_INT(0, inet_csum(0, _buf + 3, TEST_BUF_SIZE));
+}
+
+static void test_inet_csum__slices(void)
+{
+    uint16_t expected;
+
+    _fill(_buf, 300);
+    expected = inet_csum(0x38, _buf, 300);
+    /* every split into three slices at odd and even boundaries */
+    for (uint16_t first = 0; first <= 300; first += 7) {
+        for (uint16_t second = 0; (first + second) <= 300; second += 13) {
+            uint16_t sum = inet_csum_slice(0x38, _buf, first, 0);
+
+            sum = inet_csum_slice(sum, _buf + first, second, first);
+            sum = inet_csum_slice(sum, _buf + first + second,
+                                  300 - first - second, first + second);
+            TEST_ASSERT_EQUAL_INT(expected, sum);
+        }
+    }
+}
+
+static void test_inet_csum__slice_copy(void)
+{
+    static uint8_t dst[TEST_BUF_SIZE + sizeof(uint32_t)];
+
+    _fill(_buf, sizeof(_buf));
+    /* every combination of source and destination alignment */
+    for (unsigned src_off = 0; src_off < sizeof(uint32_t); src_off++) {
+        for (unsigned dst_off = 0; dst_off < sizeof(uint32_t); dst_off++) {
+            for (uint16_t len = 0; len <= 200; len += 1 + (len / 8)) {
+                for (size_t accum_len = 0; accum_len < 2; accum_len++) {
+                    memset(dst, 0xa5, sizeof(dst));
+                    TEST_ASSERT_EQUAL_INT(
+                        inet_csum_slice(0x1785, _buf + src_off, len, accum_len),
+                        inet_csum_slice_copy(0x1785, dst + dst_off,
+                                             _buf + src_off, len, accum_len));
+                    TEST_ASSERT_EQUAL_INT(0, memcmp(dst + dst_off, _buf + src_off,
+                                                    len));
+                    /* nothing written behind the copy */
+                    TEST_ASSERT_EQUAL_INT(0xa5, dst[dst_off + len]);
+                }
+            }
+        }
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,9 +317,14 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__equivalence),
+        new_TestFixture(test_inet_csum__equivalence_random),
+        new_TestFixture(test_inet_csum__all_ones),
+        new_TestFixture(test_inet_csum__slices),
+        new_TestFixture(test_inet_csum__slice_copy),
     };
 
-    EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
+    EMB_UNIT_TESTCALLER(inet_csum_tests, set_up, NULL, fixtures);
 
     return (Test *)&inet_csum_tests;
 }
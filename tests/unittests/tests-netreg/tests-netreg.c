@@ -139,6 +139,38 @@ void test_netreg_getnext__2_entries(void)
     TEST_ASSERT_NOT_NULL(gnrc_netreg_getnext(res));
 }
 
+void test_netreg_lookup_num__2_entries(void)
+{
+    gnrc_netreg_entry_t *res = NULL;
+    int num = -1;
+
+    TEST_ASSERT_NULL(gnrc_netreg_lookup_num(GNRC_NETTYPE_TEST, TEST_UINT16, &num));
+    TEST_ASSERT_EQUAL_INT(0, num);
+    test_netreg_num__2_entries();
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup_num(GNRC_NETTYPE_TEST,
+                                                       TEST_UINT16, &num)));
+    TEST_ASSERT(res == gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_EQUAL_INT(2, num);
+}
+
+void test_netreg_getnext__interleaved(void)
+{
+    static gnrc_netreg_entry_t other = GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16 + 1,
+                                                                  TEST_UINT8);
+    gnrc_netreg_entry_t *res = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &other));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[1]));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16)));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_getnext(res)));
+    TEST_ASSERT_EQUAL_INT(TEST_UINT16, res->demux_ctx);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT(&other == gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + 1));
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(&other));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + 1));
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -155,6 +187,8 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_lookup_num__2_entries),
+        new_TestFixture(test_netreg_getnext__interleaved),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "universal_address.h"
+
+#include "tests-universal_address.h"
+
+#define TEST_ADDR_SIZE          (16U)
+#define TEST_COLLISIONS         (3U)
+
+#ifndef UNIVERSAL_ADDRESS_HASH_SIZE
+#define UNIVERSAL_ADDRESS_HASH_SIZE (UNIVERSAL_ADDRESS_MAX_ENTRIES)
+#endif
+
+static void _addr(uint8_t *addr, unsigned i)
+{
+    /* IPv6 like addresses only differing in the last bytes, as in a FIB */
+    memset(addr, 0, TEST_ADDR_SIZE);
+    addr[0] = 0xfd;
+    addr[11] = 0xff;
+    addr[12] = 0xfe;
+    addr[14] = i >> 8;
+    addr[15] = i & 0xff;
+}
+
+static unsigned _bucket(const uint8_t *addr)
+{
+    /* same FNV-1a as the address index */
+    uint32_t hash = 2166136261U;
+
+    for (unsigned i = 0; i < TEST_ADDR_SIZE; i++) {
+        hash = (hash ^ addr[i]) * 16777619U;
+    }
+    return hash % UNIVERSAL_ADDRESS_HASH_SIZE;
+}
+
+static unsigned _capacity(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+    unsigned numof = 0;
+
+    _addr(addr, numof);
+    while (universal_address_add(addr, sizeof(addr)) != NULL) {
+        _addr(addr, ++numof);
+    }
+    universal_address_init();
+    return numof;
+}
+
+static void set_up(void)
+{
+    universal_address_init();
+}
+
+static void test_universal_address_add__shared(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+    universal_address_container_t *entry;
+
+    _addr(addr, 1);
+    TEST_ASSERT_NOT_NULL((entry = universal_address_add(addr, sizeof(addr))));
+    TEST_ASSERT(universal_address_add(addr, sizeof(addr)) == entry);
+    TEST_ASSERT_EQUAL_INT(2, entry->use_count);
+    TEST_ASSERT_EQUAL_INT(1, universal_address_get_num_used_entries());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(entry->address, addr, sizeof(addr)));
+}
+
+static void test_universal_address_add__distinct_size(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+    universal_address_container_t *entry;
+
+    _addr(addr, 1);
+    TEST_ASSERT_NOT_NULL((entry = universal_address_add(addr, sizeof(addr))));
+    TEST_ASSERT(universal_address_add(addr, sizeof(addr) - 1) != entry);
+    TEST_ASSERT_EQUAL_INT(2, universal_address_get_num_used_entries());
+}
+
+static void test_universal_address_add__many_users(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+    universal_address_container_t *entry = NULL;
+
+    /* more users than fit into a byte, e.g. one next hop for many routes */
+    _addr(addr, 1);
+    for (unsigned i = 0; i < 300; i++) {
+        TEST_ASSERT_NOT_NULL((entry = universal_address_add(addr, sizeof(addr))));
+    }
+    TEST_ASSERT_EQUAL_INT(300, entry->use_count);
+    for (unsigned i = 0; i < 299; i++) {
+        universal_address_rem(entry);
+    }
+    TEST_ASSERT_EQUAL_INT(1, universal_address_get_num_used_entries());
+    universal_address_rem(entry);
+    TEST_ASSERT_EQUAL_INT(0, universal_address_get_num_used_entries());
+}
+
+static void test_universal_address_add__collisions(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+    universal_address_container_t *entries[TEST_COLLISIONS];
+    unsigned ids[TEST_COLLISIONS];
+    unsigned bucket, numof = 0;
+
+    /* find addresses sharing a bucket of the index */
+    _addr(addr, 0);
+    bucket = _bucket(addr);
+    for (unsigned i = 0; (i <= UINT16_MAX) && (numof < TEST_COLLISIONS); i++) {
+        _addr(addr, i);
+        if (_bucket(addr) == bucket) {
+            ids[numof++] = i;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_COLLISIONS, numof);
+    for (unsigned i = 0; i < TEST_COLLISIONS; i++) {
+        _addr(addr, ids[i]);
+        TEST_ASSERT_NOT_NULL((entries[i] = universal_address_add(addr, sizeof(addr))));
+    }
+    for (unsigned i = 0; i < TEST_COLLISIONS; i++) {
+        _addr(addr, ids[i]);
+        TEST_ASSERT(universal_address_add(addr, sizeof(addr)) == entries[i]);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(entries[i]->address, addr, sizeof(addr)));
+        universal_address_rem(entries[i]);
+    }
+
+    /* unlinking the middle of the chain keeps its neighbours reachable */
+    universal_address_rem(entries[1]);
+    TEST_ASSERT_EQUAL_INT(TEST_COLLISIONS - 1,
+                          universal_address_get_num_used_entries());
+    _addr(addr, ids[0]);
+    TEST_ASSERT(universal_address_add(addr, sizeof(addr)) == entries[0]);
+    TEST_ASSERT_EQUAL_INT(2, entries[0]->use_count);
+    _addr(addr, ids[2]);
+    TEST_ASSERT(universal_address_add(addr, sizeof(addr)) == entries[2]);
+    TEST_ASSERT_EQUAL_INT(2, entries[2]->use_count);
+    /* and the removed address comes back with a fresh count */
+    _addr(addr, ids[1]);
+    TEST_ASSERT(universal_address_add(addr, sizeof(addr)) == entries[1]);
+    TEST_ASSERT_EQUAL_INT(1, entries[1]->use_count);
+    TEST_ASSERT_EQUAL_INT(TEST_COLLISIONS,
+                          universal_address_get_num_used_entries());
+}
+
+static void test_universal_address_rem__refcount(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+    universal_address_container_t *entry;
+
+    _addr(addr, 1);
+    TEST_ASSERT_NOT_NULL((entry = universal_address_add(addr, sizeof(addr))));
+    TEST_ASSERT_NOT_NULL(universal_address_add(addr, sizeof(addr)));
+    universal_address_rem(entry);
+    TEST_ASSERT_EQUAL_INT(1, universal_address_get_num_used_entries());
+    TEST_ASSERT(universal_address_add(addr, sizeof(addr)) == entry);
+    universal_address_rem(entry);
+    universal_address_rem(entry);
+    TEST_ASSERT_EQUAL_INT(0, universal_address_get_num_used_entries());
+    /* removing an unused entry must not underflow */
+    universal_address_rem(entry);
+    TEST_ASSERT_EQUAL_INT(0, entry->use_count);
+    TEST_ASSERT_EQUAL_INT(0, universal_address_get_num_used_entries());
+}
+
+static void test_universal_address_rem__reuse(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+    universal_address_container_t *entry, *first = NULL;
+    unsigned numof = _capacity();
+
+    TEST_ASSERT(numof > 1);
+    for (unsigned i = 0; i < numof; i++) {
+        _addr(addr, i);
+        TEST_ASSERT_NOT_NULL((entry = universal_address_add(addr, sizeof(addr))));
+        if (i == 0) {
+            first = entry;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(numof, universal_address_get_num_used_entries());
+    _addr(addr, numof);
+    TEST_ASSERT_NULL(universal_address_add(addr, sizeof(addr)));
+
+    /* the container of the last user is free for other addresses */
+    universal_address_rem(first);
+    TEST_ASSERT(universal_address_add(addr, sizeof(addr)) == first);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(first->address, addr, sizeof(addr)));
+    /* and the former address is gone */
+    _addr(addr, 0);
+    TEST_ASSERT_NULL(universal_address_add(addr, sizeof(addr)));
+    /* all others can still be found */
+    for (unsigned i = 1; i < numof; i++) {
+        _addr(addr, i);
+        TEST_ASSERT_NOT_NULL((entry = universal_address_add(addr, sizeof(addr))));
+        TEST_ASSERT_EQUAL_INT(2, entry->use_count);
+    }
+}
+
+static void test_universal_address_reset(void)
+{
+    uint8_t addr[TEST_ADDR_SIZE];
+    universal_address_container_t *entry;
+
+    _addr(addr, 1);
+    TEST_ASSERT_NOT_NULL(universal_address_add(addr, sizeof(addr)));
+    TEST_ASSERT_NOT_NULL(universal_address_add(addr, sizeof(addr)));
+    universal_address_reset();
+    TEST_ASSERT_EQUAL_INT(0, universal_address_get_num_used_entries());
+    TEST_ASSERT_NOT_NULL((entry = universal_address_add(addr, sizeof(addr))));
+    TEST_ASSERT_EQUAL_INT(1, entry->use_count);
+    TEST_ASSERT_EQUAL_INT(1, universal_address_get_num_used_entries());
+}
+
+Test *tests_universal_address_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_universal_address_add__shared),
+        new_TestFixture(test_universal_address_add__distinct_size),
+        new_TestFixture(test_universal_address_add__many_users),
+        new_TestFixture(test_universal_address_add__collisions),
+        new_TestFixture(test_universal_address_rem__refcount),
+        new_TestFixture(test_universal_address_rem__reuse),
+        new_TestFixture(test_universal_address_reset),
+    };
+
+    EMB_UNIT_TESTCALLER(universal_address_tests, set_up, NULL, fixtures);
+
+    return (Test *)&universal_address_tests;
+}
+
+void tests_universal_address(void)
+{
+    TESTS_RUN(tests_universal_address_tests());
+}
+/** @} */
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Compares the wakeups of periodic timers with and without slack
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TIMERS
+#define TIMERS          (16U)
+#endif
+#ifndef SLACK
+#define SLACK           (20U * MS_IN_USEC)
+#endif
+#define DURATION        (5U * SEC_IN_USEC)
+#define PERIOD_MIN      (50U * MS_IN_USEC)
+#define PERIOD_MAX      (150U * MS_IN_USEC)
+
+static xtimer_t timers[TIMERS];
+static uint32_t periods[TIMERS];
+static uint32_t targets[TIMERS];
+static volatile uint32_t fired;
+static volatile uint32_t max_early;
+static volatile int stop;
+static uint32_t slack;
+
+static void _set(unsigned i, uint32_t offset)
+{
+    targets[i] = xtimer_now_usec() + offset;
+    xtimer_set_slack(&timers[i], offset, slack);
+}
+
+static void _cb(void *arg)
+{
+    unsigned i = (unsigned)(uintptr_t)arg;
+    int32_t early = (int32_t)(targets[i] - xtimer_now_usec());
+
+    if ((early > 0) && ((uint32_t)early > max_early)) {
+        max_early = early;
+    }
+    fired++;
+    if (!stop) {
+        _set(i, periods[i]);
+    }
+}
+
+static uint32_t _run(void)
+{
+    uint32_t wakeups;
+
+    fired = 0;
+    stop = 0;
+    for (unsigned i = 0; i < TIMERS; i++) {
+        /* random phases, so no two timers expire at the same time */
+        _set(i, random_uint32_range(PERIOD_MIN, PERIOD_MAX));
+    }
+
+    wakeups = xtimer_wakeups();
+    xtimer_usleep(DURATION);
+    wakeups = xtimer_wakeups() - wakeups;
+
+    stop = 1;
+    for (unsigned i = 0; i < TIMERS; i++) {
+        xtimer_remove(&timers[i]);
+    }
+
+    wakeups /= DURATION / SEC_IN_USEC;
+    printf("slack %" PRIu32 " us: %" PRIu32 " fired, %" PRIu32 " wakeups/s, "
+           "max early %" PRIu32 " us\n", slack, fired, wakeups, max_early);
+
+    return wakeups;
+}
+
+int main(void)
+{
+    uint32_t exact, relaxed;
+
+#ifdef MODULE_XTIMER_SLACK
+    printf("xtimer slack test (%u timers, slack: on)\n", TIMERS);
+#else
+    printf("xtimer slack test (%u timers, slack: off)\n", TIMERS);
+#endif
+
+    for (unsigned i = 0; i < TIMERS; i++) {
+        timers[i].callback = _cb;
+        timers[i].arg = (void *)(uintptr_t)i;
+        periods[i] = random_uint32_range(PERIOD_MIN, PERIOD_MAX);
+    }
+
+    slack = 0;
+    exact = _run();
+    slack = SLACK;
+    relaxed = _run();
+
+    if (max_early) {
+        puts("timers fired before their offset");
+        puts("[FAILURE]");
+        return 1;
+    }
+#ifdef MODULE_XTIMER_SLACK
+    if (relaxed >= exact) {
+        puts("slack did not save wakeups");
+        puts("[FAILURE]");
+        return 1;
+    }
+#else
+    (void)exact;
+    (void)relaxed;
+#endif
+    puts("[SUCCESS]");
+
+    return 0;
+}
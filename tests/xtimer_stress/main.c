@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2017 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Stresses xtimer with many pending timers
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef TIMERS
+#define TIMERS          (256U)
+#endif
+#define RESETS          (10000U)
+#define DURATION        (5U * SEC_IN_USEC)
+/* the main thread wakes up periodically while the timers fire */
+#define PERIOD          (10U * MS_IN_USEC)
+/* timers re-arm themselves like protocol timers, between 1 ms and 1 s */
+#define OFFSET_MIN      (1000U)
+#define OFFSET_MAX      (SEC_IN_USEC)
+
+static xtimer_t timers[TIMERS];
+static uint32_t targets[TIMERS];
+static volatile uint32_t fired[TIMERS];
+static volatile uint32_t max_late;
+static volatile int stop;
+
+static void _set(unsigned i)
+{
+    uint32_t offset = random_uint32_range(OFFSET_MIN, OFFSET_MAX);
+
+    targets[i] = xtimer_now_usec() + offset;
+    xtimer_set(&timers[i], offset);
+}
+
+static void _cb(void *arg)
+{
+    unsigned i = (unsigned)(uintptr_t)arg;
+    uint32_t late = xtimer_now_usec() - targets[i];
+
+    if (late > max_late) {
+        max_late = late;
+    }
+    fired[i]++;
+    if (!stop) {
+        _set(i);
+    }
+}
+
+int main(void)
+{
+    xtimer_ticks32_t last_wakeup;
+    uint32_t start, total = 0;
+    unsigned never = 0;
+
+#ifdef MODULE_XTIMER_HEAP
+    printf("xtimer stress test (%u timers, heap)\n", TIMERS);
+#else
+    printf("xtimer stress test (%u timers, lists)\n", TIMERS);
+#endif
+
+    for (unsigned i = 0; i < TIMERS; i++) {
+        timers[i].callback = _cb;
+        timers[i].arg = (void *)(uintptr_t)i;
+        _set(i);
+    }
+
+    /* what a busy protocol stack does: reset pending timers */
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < RESETS; i++) {
+        unsigned state = irq_disable();
+        _set(random_uint32_range(0, TIMERS));
+        irq_restore(state);
+    }
+    printf("xtimer_set: %" PRIu32 " ns per reset with %u pending timers\n",
+           (uint32_t)(((uint64_t)(xtimer_now_usec() - start) * 1000) / RESETS),
+           TIMERS);
+
+    last_wakeup = xtimer_now();
+    for (unsigned i = 0; i < (DURATION / PERIOD); i++) {
+        xtimer_periodic_wakeup(&last_wakeup, PERIOD);
+    }
+    stop = 1;
+    for (unsigned i = 0; i < TIMERS; i++) {
+        xtimer_remove(&timers[i]);
+        total += fired[i];
+        if (fired[i] == 0) {
+            never++;
+        }
+    }
+
+    printf("fired: %" PRIu32 " callbacks in %u s\n", total,
+           (unsigned)(DURATION / SEC_IN_USEC));
+    printf("max latency: %" PRIu32 " us\n", max_late);
+
+    if (never) {
+        printf("%u timers never fired\n", never);
+        puts("[FAILURE]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+
+    return 0;
+}